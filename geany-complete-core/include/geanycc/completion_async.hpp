@@ -21,7 +21,10 @@
 
 #pragma once
 
+#include <functional>
+
 #include "completion_base.hpp"
+#include "job_scheduler.hpp"
 
 namespace geanycc
 {
@@ -35,8 +38,25 @@ class CodeCompletionAsyncWrapper
 	CodeCompletionAsyncWrapper(CodeCompletionBase* completion);
 	~CodeCompletionAsyncWrapper();
 	void set_option(std::vector<std::string>& options);
-	void complete_async(const char* filename, const char* content, int line, int col, int flag = 0);
+	void set_settings(const CodeCompletionSettings& settings);
+	void complete_async(const char* filename, DocumentSnapshotPtr content, int line, int col,
+	                    const char* prefix, int flag = 0);
+	/// @attention the previous contents of @param result are discarded
 	bool try_get_results(CodeCompletionResults& result);
+	/// parse ahead in the background, as a warm-up or idle job (see job_scheduler.hpp)
+	void prepare_async(const char* filename, DocumentSnapshotPtr content,
+	                   JobPriority priority = JOB_WARMUP);
+	/// drop what was parsed for @param filename, in place of a parse ahead still queued
+	void release_async(const char* filename);
+	/// @attention @param callback is called on the worker thread when results become ready
+	void set_ready_callback(std::function<void()> callback);
+
+	/// true while a completion is waiting or running
+	bool is_busy();
+	/// jobs of @param priority waiting for a worker
+	size_t get_queue_depth(JobPriority priority);
+	/// recent time to complete in @param filename (milliseconds), or -1 if not known yet
+	int get_latency(const char* filename);
 
    private:
 	class CodeCompletionAsyncWrapperImpl;
@@ -22,6 +22,8 @@
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <cstdint>
 
 namespace geanycc
 {
@@ -40,6 +42,14 @@ enum CompleteResultType
 	COMPLETE_RESULT_NONE,
 };
 
+/// flags of CodeCompletionBase::complete
+enum CompleteFlag
+{
+	/// the prefix was extended by typing at the end of it, nothing else changed since the last
+	/// request at the same position
+	COMPLETE_FLAG_REFINE = 1,
+};
+
 enum CompleteResultAvailability
 {
 	COMPLETE_RESULT_AVAIL_AVAIL,
@@ -48,33 +58,227 @@ enum CompleteResultAvailability
 	COMPLETE_RESULT_AVAIL_NOTACCESS
 };
 
-struct CompleteResultRow
+class CodeCompletionResults;
+
+/**
+    source of the texts of results which are built only when a row is displayed.
+    an engine keeps its raw results alive behind this; it must be safe to call from the main
+    thread while the engine works on another request.
+*/
+class CompletionDetails
+{
+   public:
+	virtual ~CompletionDetails() {}
+	/// set every text but the typed text of @a row, built from engine result @a source
+	virtual void describe(CodeCompletionResults& results, size_t row, uint32_t source) = 0;
+};
+
+/**
+    completion results stored column-wise.
+    kinds are packed in byte arrays and all texts live in one arena which rows refer to by
+    offset, so that filling a reused container does not allocate per row.
+*/
+class CodeCompletionResults
 {
-	CompleteResultType type;
-	CompleteResultAvailability availability;
-	std::string typed_text;
-	std::string return_type;
-	std::string arguments;
-	std::string signature;
-	CompleteResultRow()
+   public:
+	enum TextField { TYPED_TEXT, RETURN_TYPE, ARGUMENTS, SIGNATURE, TEXT_FIELD_COUNT };
+
+	CodeCompletionResults() { clear(); }
+
+	size_t size() const { return types.size(); }
+	bool empty() const { return types.empty(); }
+
+	/// remove all rows but keep the capacity for the next request
+	void clear()
 	{
-		typed_text.reserve(100);
-		return_type.reserve(100);
-		arguments.reserve(200);
-		signature.reserve(400);
+		types.clear();
+		availabilities.clear();
+		sources.clear();
+		described.clear();
+		texts.clear();
+		arena.assign(1, '\0');  // offset 0 is the empty string
+		details.reset();
+		total_count = 0;
+		filter_prefix.clear();
 	}
+
+	void reserve(size_t rows, size_t text_bytes = 0)
+	{
+		types.reserve(rows);
+		availabilities.reserve(rows);
+		sources.reserve(rows);
+		described.reserve(rows);
+		texts.reserve(rows * TEXT_FIELD_COUNT);
+		arena.reserve(text_bytes);
+	}
+
+	void swap(CodeCompletionResults& other)
+	{
+		types.swap(other.types);
+		availabilities.swap(other.availabilities);
+		sources.swap(other.sources);
+		described.swap(other.described);
+		texts.swap(other.texts);
+		arena.swap(other.arena);
+		details.swap(other.details);
+		std::swap(total_count, other.total_count);
+		filter_prefix.swap(other.filter_prefix);
+	}
+
+	/**
+	    append a row with empty texts and return its index.
+	    texts other than the typed text may be left to @a details, see describe().
+	*/
+	size_t add(CompleteResultType type, CompleteResultAvailability availability,
+	           uint32_t source = 0)
+	{
+		types.push_back((uint8_t)type);
+		availabilities.push_back((uint8_t)availability);
+		sources.push_back(source);
+		described.push_back(!details);
+		texts.resize(texts.size() + TEXT_FIELD_COUNT);
+		return types.size() - 1;
+	}
+
+	/// copy @a text into the arena
+	void set_text(size_t row, TextField field, const char* text, size_t length)
+	{
+		TextRef& ref = texts[row * TEXT_FIELD_COUNT + field];
+		if (length == 0) {
+			return;  // already refers to the empty string
+		}
+		ref.offset = arena.size();
+		ref.length = length;
+		arena.insert(arena.end(), text, text + length);
+		arena.push_back('\0');
+	}
+	void set_text(size_t row, TextField field, const std::string& text)
+	{
+		set_text(row, field, text.c_str(), text.length());
+	}
+
+	/// number of candidates which matched the prefix, rows are the best of them
+	size_t total() const { return total_count; }
+	void set_total(size_t total) { total_count = total; }
+	/// typed texts of all rows start with this
+	const std::string& prefix() const { return filter_prefix; }
+	void set_prefix(const std::string& prefix) { filter_prefix = prefix; }
+
+	/// set before adding rows whose texts are built on demand
+	void set_details(const std::shared_ptr<CompletionDetails>& source) { details = source; }
+
+	/// build the texts of @a row if they are not built yet
+	void describe(size_t row)
+	{
+		if (!described[row]) {
+			described[row] = true;
+			details->describe(*this, row, sources[row]);
+		}
+	}
+
+	CompleteResultType type(size_t row) const { return (CompleteResultType)types[row]; }
+	CompleteResultAvailability availability(size_t row) const
+	{
+		return (CompleteResultAvailability)availabilities[row];
+	}
+
+	/// @attention null terminated, valid until the container is modified.
+	/// texts other than the typed text are empty until describe() is called
+	const char* text(size_t row, TextField field) const
+	{
+		return &arena[texts[row * TEXT_FIELD_COUNT + field].offset];
+	}
+	size_t text_length(size_t row, TextField field) const
+	{
+		return texts[row * TEXT_FIELD_COUNT + field].length;
+	}
+
+	const char* typed_text(size_t row) const { return text(row, TYPED_TEXT); }
+	const char* return_type(size_t row) const { return text(row, RETURN_TYPE); }
+	const char* arguments(size_t row) const { return text(row, ARGUMENTS); }
+	const char* signature(size_t row) const { return text(row, SIGNATURE); }
+
+   private:
+	struct TextRef
+	{
+		uint32_t offset = 0;
+		uint32_t length = 0;
+	};
+
+	std::vector<uint8_t> types;
+	std::vector<uint8_t> availabilities;
+	std::vector<uint32_t> sources;  // index into the engine results
+	std::vector<uint8_t> described;
+	std::vector<TextRef> texts;  // TEXT_FIELD_COUNT per row
+	std::vector<char> arena;
+	std::shared_ptr<CompletionDetails> details;
+	size_t total_count = 0;
+	std::string filter_prefix;
 };
 
-typedef std::vector<CompleteResultRow> CodeCompletionResults;
+/// results shared by the suggestion window and the recently shown ones, on the main thread
+typedef std::shared_ptr<CodeCompletionResults> CodeCompletionResultsPtr;
+
+/**
+    an immutable copy of a document, taken once on the editor side and shared by reference
+    with the worker and the engine.
+*/
+class DocumentSnapshot
+{
+   public:
+	DocumentSnapshot(const char* text, size_t length) : text(text, length) {}
+	/// null terminated
+	const char* data() const { return text.c_str(); }
+	size_t length() const { return text.length(); }
+
+   private:
+	DocumentSnapshot(const DocumentSnapshot&);
+	void operator=(const DocumentSnapshot&);
+
+	const std::string text;
+};
+
+typedef std::shared_ptr<const DocumentSnapshot> DocumentSnapshotPtr;
+
+/// engine settings which are independent of compiler options
+struct CodeCompletionSettings
+{
+	size_t tu_cache_memory_limit = 0;  /// bytes of parsed units to keep (0: unlimited)
+	std::string preamble_cache_dir;     /// where precompiled preambles are stored
+	size_t preamble_cache_size_limit = 0;  /// bytes of precompiled preambles (0: disabled)
+	size_t max_results = 0;                /// best results to return (0: all)
+	bool fuzzy_filter = false;             /// match the prefix as a subsequence
+	bool use_compilation_database = false;  /// per-file options from compile_commands.json
+	size_t stale_kill_ms = 0;  /// a superseded completion running this long is killed, if the
+	                           /// engine runs in another process (0: never)
+};
 
+/**
+    an engine. prepare() may run on several threads at once, for different files or beside
+    complete(), so an implementation must lock what files share. complete() is not called
+    concurrently with itself, and set_option() / set_settings() only while nothing runs.
+*/
 class CodeCompletionBase
 {
    public:
 	CodeCompletionBase() {}
 	virtual ~CodeCompletionBase() {}
 	virtual void set_option(std::vector<std::string>& options) = 0;
-	virtual void complete(CodeCompletionResults& result, const char* filename, const char* content,
-	                      int line, int col, int flag = 0) = 0;
+	virtual void set_settings(const CodeCompletionSettings& settings) {}
+	/// complete at @a line and @a col, returning only results which start with @a prefix
+	virtual void complete(CodeCompletionResults& result, const char* filename,
+	                      const DocumentSnapshot& content, int line, int col,
+	                      const char* prefix, int flag = 0) = 0;
+	/// parse ahead so that the first completion in the file does not wait for it
+	virtual void prepare(const char* filename, const DocumentSnapshot& content) {}
+	/// the editor has closed @a filename, what was parsed for it is not needed any more
+	virtual void release(const char* filename) {}
+	/**
+	    a newer request supersedes the complete() which runs now, if any, but not later ones.
+	    an engine which can abort may return from it early with no results.
+	    called from another thread.
+	*/
+	virtual void cancel() {}
 };
 
 } // namespace geanycc
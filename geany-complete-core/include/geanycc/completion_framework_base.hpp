@@ -49,6 +49,10 @@ class CompletionFrameworkBase
 	/// return true if typed . -> :: except for comments and strings, otherwise false.
 	virtual bool check_trigger_char(GeanyEditor* editor) = 0;
 
+	/// return true if an identifier typed at the cursor may start completion (not in comments
+	/// and strings), otherwise false.
+	virtual bool check_identifier_trigger(GeanyEditor* editor) = 0;
+
 	/// plugin setting widget
 	virtual GtkWidget* create_config_widget(GtkDialog* dialog) = 0;
 
@@ -56,19 +60,43 @@ class CompletionFrameworkBase
 	virtual void updated_preferences() = 0;
 	virtual void save_preferences() = 0;
 
+	/// replace the engine, waiting for what the current one runs. options and settings
+	/// must be set again.
+	void set_engine(CodeCompletionBase* engine);
+
 	/// async completion class wrapper
 	void set_completion_option(std::vector<std::string>& options);
-	void complete_async(const char* filename, const char* content, int line, int col, int flag = 0);
+	void set_completion_settings(const CodeCompletionSettings& settings);
+	void complete_async(const char* filename, DocumentSnapshotPtr content, int line, int col,
+	                    const char* prefix, int flag = 0);
 	bool try_get_completion_results(CodeCompletionResults& result);
+	void prepare_async(const char* filename, DocumentSnapshotPtr content,
+	                   JobPriority priority = JOB_WARMUP);
+	void release_async(const char* filename);
+	/// @attention @param callback is called on a worker thread
+	void set_results_ready_callback(std::function<void()> callback);
+
+	bool is_completion_busy();
+	int get_completion_latency(const char* filename);
+	size_t get_queue_depth(JobPriority priority);
 
 	void set_suggestion_window(SuggestionWindow* window) { suggestion_window = window; }
 
+	/// identifier characters typed before completion starts by itself, 0 if it does not
+	int get_auto_trigger_chars() const { return auto_trigger_chars; }
+	/// milliseconds to wait for a completion before recent results are shown, 0 if forever
+	int get_completion_deadline() const { return completion_deadline_ms; }
+
 	/// return path to configure file
 	std::string get_config_file();
    protected:
 	CodeCompletionAsyncWrapper* completion = nullptr;
 	SuggestionWindow* suggestion_window = nullptr;
+	int auto_trigger_chars = 0;
+	int completion_deadline_ms = 0;
 
+   private:
+	std::function<void()> ready_callback;  // kept for the next engine
 };
 
 }
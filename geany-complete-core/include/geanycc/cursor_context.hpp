@@ -0,0 +1,56 @@
+/*
+ * cursor_context.hpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+
+#pragma once
+
+#include "cc_plugin.hpp"
+
+namespace geanycc
+{
+enum CursorContextKind {
+	CURSOR_CONTEXT_NONE = 0,    // nothing to complete here
+	CURSOR_CONTEXT_IDENTIFIER,  // a word (maybe empty) after anything else
+	CURSOR_CONTEXT_MEMBER,      // after "." or "->"
+	CURSOR_CONTEXT_SCOPE,       // after "::"
+	CURSOR_CONTEXT_INCLUDE      // in the file name of #include
+};
+
+struct CursorContext
+{
+	CursorContextKind kind;
+	int word_start;  // document position where the word being completed starts
+};
+
+/// bytes of the line before the cursor looked at, at most
+const int CURSOR_CONTEXT_LOOKBACK = 512;
+
+/**
+    classify the end of @a text, which is the line before the cursor or its last bytes.
+    @a text_pos is the document position of text[0], @a at_line_start is false if text is
+    cut by the lookback. a word reaching the cut is not completed.
+*/
+CursorContext analyse_cursor_context(const char* text, int length, int text_pos,
+                                     bool at_line_start);
+
+/// the context at the caret, read from the buffer without a message per character
+CursorContext get_cursor_context(ScintillaObject* sci);
+}
@@ -0,0 +1,69 @@
+/*
+ * fuzzy_match.hpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace geanycc
+{
+/**
+    matches a query as a case-insensitive subsequence of identifiers, preferring
+    characters at word starts (camelCase humps and after '_'), e.g. "gBC" -> getBufferCapacity.
+    return false if @a query does not match, else set @a score of @a text (higher is better,
+    it may be negative).
+*/
+bool fuzzy_match(const char* query, size_t query_length, const char* text, size_t text_length,
+                 int& score);
+
+/**
+    scores many candidates against a query.
+    texts are packed in one arena together with a bit mask of the characters each contains,
+    so a candidate lacking a character of the query is rejected by one AND.
+*/
+class FuzzyMatcher
+{
+   public:
+	struct Match
+	{
+		int score;
+		uint32_t index;  // order of add()
+	};
+
+	FuzzyMatcher() { clear(); }
+
+	void clear();
+	void reserve(size_t candidates, size_t text_bytes);
+	void add(const char* text, size_t length);
+	size_t size() const { return masks.size(); }
+
+	/// fill @a matches with the matching candidates, best first
+	void match(const std::string& query, std::vector<Match>& matches);
+
+   private:
+	std::vector<uint64_t> masks;
+	std::vector<uint32_t> offsets;  // size() + 1 entries into arena
+	std::vector<char> arena;
+	std::vector<uint8_t> passed;  // scratch for the mask filter
+};
+}
@@ -26,4 +26,9 @@
 #include <geanycc/completion_async.hpp>
 #include <geanycc/completion_base.hpp>
 #include <geanycc/completion_framework_base.hpp>
+#include <geanycc/cursor_context.hpp>
+#include <geanycc/fuzzy_match.hpp>
+#include <geanycc/job_scheduler.hpp>
+#include <geanycc/remote_completion.hpp>
+#include <geanycc/suggestion_model.hpp>
 #include <geanycc/suggestion_window.hpp>
@@ -0,0 +1,75 @@
+/*
+ * job_scheduler.hpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+namespace geanycc
+{
+/// lower values are served first
+enum JobPriority {
+	JOB_INTERACTIVE = 0,  // what the user waits for, e.g. a completion
+	JOB_WARMUP,           // parsing the document the user just turned to
+	JOB_IDLE,             // parsing other documents
+	JOB_PRIORITY_COUNT
+};
+
+/**
+    runs jobs on a pool of worker threads, highest priority first.
+    a job is never interrupted, a higher priority one waits at most for the next job boundary.
+    with more than one worker, one of them is kept for interactive jobs and the others run
+    the lower classes at a lowered thread priority, which threads libclang starts inherit.
+    idle jobs run only while no interactive or warm-up job is queued.
+*/
+class JobScheduler
+{
+   public:
+	typedef std::function<void()> Job;
+
+	explicit JobScheduler(size_t workers);
+	/// waits for running jobs, queued ones are dropped
+	~JobScheduler();
+
+	/**
+	    queue @a job. it replaces a queued job with the same @a key, which keeps the higher of
+	    both priorities. interactive jobs run one at a time, others one at a time per key.
+	*/
+	void post(JobPriority priority, const std::string& key, Job job);
+
+	/// call @a f on this thread while no job runs. queued jobs wait for it.
+	void run_exclusive(const std::function<void()>& f);
+
+	size_t get_queue_depth(JobPriority priority);
+	size_t get_running(JobPriority priority);
+
+	/// workers for parsing on this machine, bounded since each parse may take hundreds of MB
+	static size_t default_workers();
+
+   private:
+	class JobSchedulerImpl;
+	JobSchedulerImpl* pimpl;
+
+	JobScheduler(const JobScheduler&);
+	void operator=(const JobScheduler&);
+};
+}
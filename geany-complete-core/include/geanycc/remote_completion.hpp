@@ -0,0 +1,88 @@
+/*
+ * remote_completion.hpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "completion_base.hpp"
+
+namespace geanycc
+{
+/**
+    an engine which runs in a helper process, so that a crash of the compiler library does not
+    take the editor down, and a completion which is not wanted anymore can be aborted.
+    the helper is started on first use with its end of a socket as standard input
+    (see serve_completion()). if it dies, or is killed because a superseded completion ran
+    longer than CodeCompletionSettings::stale_kill_ms, the next call starts it again and it
+    reparses the files used most recently, which the preamble cache on disk keeps cheap.
+    with a socket path, it uses instead the daemon of this user which listens there (see
+    serve_shared_completion()), so that editors share what has been parsed. the daemon is
+    started if none listens, and is not killed for a stale completion but left to finish it.
+*/
+class RemoteCodeCompletion : public CodeCompletionBase
+{
+   public:
+	/**
+	    @param command path of the helper executable
+	    @param socket_path where the shared daemon listens, empty for a helper of its own
+	*/
+	explicit RemoteCodeCompletion(const std::string& command,
+	                              const std::string& socket_path = "");
+	virtual ~RemoteCodeCompletion();
+
+	void set_option(std::vector<std::string>& options);
+	void set_settings(const CodeCompletionSettings& settings);
+	void complete(CodeCompletionResults& result, const char* filename,
+	              const DocumentSnapshot& content, int line, int col, const char* prefix,
+	              int flag = 0);
+	void prepare(const char* filename, const DocumentSnapshot& content);
+	void release(const char* filename);
+	void cancel();
+
+   private:
+	class RemoteCodeCompletionImpl;
+	RemoteCodeCompletionImpl* pimpl;
+
+	RemoteCodeCompletion(const RemoteCodeCompletion&);
+	void operator=(const RemoteCodeCompletion&);
+};
+
+/// makes an engine for each set of options and settings which clients send
+typedef std::function<CodeCompletionBase*()> EngineFactory;
+
+/**
+    serve requests of a RemoteCodeCompletion on @a fd with engines from @a create_engine,
+    until the other end closes. completions and parses run on a JobScheduler, so that they
+    overlap as they would in the editor process.
+*/
+void serve_completion(const EngineFactory& create_engine, int fd);
+/**
+    serve every RemoteCodeCompletion which connects to @a socket_path. clients with the same
+    options and settings share an engine from @a create_engine. a parsed file is released
+    when no client uses it anymore. return once no client has been connected for a while, or
+    at once if another daemon serves @a socket_path.
+*/
+void serve_shared_completion(const EngineFactory& create_engine,
+                             const std::string& socket_path);
+}
@@ -0,0 +1,126 @@
+/*
+ * remote_protocol.hpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "completion_base.hpp"
+
+namespace geanycc
+{
+/**
+    messages between the plugin and an engine serving it from another process.
+    a message is a MessageHeader followed by @a length bytes of fields written by
+    MessageWriter. every request but those sent to restore a respawned engine is answered
+    with the same id. completion results do not go through the socket: the server writes them
+    to a shared memory object which the client names, and MSG_RESULTS only confirms it.
+    the first rows carry all their texts, later ones only their typed texts, which stand in
+    for the others. a refine carries no content, the server uses that of the last completion.
+*/
+enum MessageType {
+	MSG_SET_OPTION = 1,  // options
+	MSG_SET_SETTINGS,    // CodeCompletionSettings
+	MSG_PREPARE,         // filename, content
+	MSG_COMPLETE,        // shared memory name, filename, content, line, col, prefix, flag
+	MSG_RELEASE,         // filename
+	MSG_DONE,            // the answer to anything but MSG_COMPLETE
+	MSG_RESULTS,         // shared memory name (empty on failure), size
+};
+
+struct MessageHeader
+{
+	uint32_t type;
+	uint32_t id;
+	uint32_t length;
+};
+
+/// fields are in host byte order, both ends run on the same machine
+class MessageWriter
+{
+   public:
+	void put_u32(uint32_t value) { put_bytes(&value, sizeof(value)); }
+	void put_u64(uint64_t value) { put_bytes(&value, sizeof(value)); }
+	void put_string(const char* text, size_t length)
+	{
+		put_u32((uint32_t)length);
+		put_bytes(text, length);
+	}
+	void put_string(const std::string& text) { put_string(text.c_str(), text.length()); }
+
+	const std::string& data() const { return buffer; }
+	void clear() { buffer.clear(); }
+
+   private:
+	void put_bytes(const void* bytes, size_t length)
+	{
+		buffer.append((const char*)bytes, length);
+	}
+
+	std::string buffer;
+};
+
+/// every getter returns false once the data is exhausted
+class MessageReader
+{
+   public:
+	MessageReader(const char* data, size_t length) : data(data), rest(length) {}
+
+	bool get_u32(uint32_t& value) { return get_bytes(&value, sizeof(value)); }
+	bool get_u64(uint64_t& value) { return get_bytes(&value, sizeof(value)); }
+	bool get_string(std::string& text);
+	/// without a copy, @a text points into the message
+	bool get_string(const char*& text, size_t& length);
+
+   private:
+	bool get_bytes(void* bytes, size_t length);
+
+	const char* data;
+	size_t rest;
+};
+
+/// write a whole message. it does not raise SIGPIPE if the peer has gone.
+bool send_message(int fd, uint32_t type, uint32_t id, const MessageWriter& payload);
+/// block for the next message. return false on end of stream or error.
+bool receive_message(int fd, MessageHeader& header, std::string& payload);
+
+void write_options(MessageWriter& writer, const std::vector<std::string>& options);
+bool read_options(MessageReader& reader, std::vector<std::string>& options);
+void write_settings(MessageWriter& writer, const CodeCompletionSettings& settings);
+bool read_settings(MessageReader& reader, CodeCompletionSettings& settings);
+
+/// a name for the shared memory object which carries results to this process
+std::string make_results_name();
+/**
+    copy the kinds and typed texts of @a results to a new shared memory object @a name, with
+    the other texts of the first rows, which are described for it. @a size is set to its size.
+*/
+bool write_shared_results(const std::string& name, CodeCompletionResults& results,
+                          size_t& size);
+/**
+    copy results back from shared memory object @a name and remove it. rows which came
+    without their texts show their typed text as the signature.
+*/
+bool read_shared_results(const std::string& name, size_t size, CodeCompletionResults& results);
+}
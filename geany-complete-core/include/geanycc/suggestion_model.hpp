@@ -0,0 +1,55 @@
+/*
+ * suggestion_model.hpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#pragma once
+
+#include "cc_plugin.hpp"
+#include "completion_base.hpp"
+
+namespace geanycc
+{
+enum {
+	SUGGESTION_MODEL_TYPEDTEXT = 0,  // G_TYPE_STRING
+	SUGGESTION_MODEL_ROW,            // G_TYPE_UINT, index into the results
+	SUGGESTION_MODEL_TYPE,           // GDK_TYPE_PIXBUF
+	SUGGESTION_MODEL_N_COLUMNS
+};
+
+/**
+    a list model which reads the shown rows straight from completion results,
+    so nothing is copied per row and only rows the view asks for are touched.
+    @a icons are indexed by CompleteResultType.
+*/
+GtkTreeModel* suggestion_model_new(const std::vector<GdkPixbuf*>* icons);
+
+/**
+    show @a rows (indices into @a results) in this order.
+    @attention call while the model is not attached to a view, and keep both alive and
+    unchanged until the next call.
+*/
+void suggestion_model_set_rows(GtkTreeModel* model, const CodeCompletionResults* results,
+                               const std::vector<uint32_t>* rows);
+/**
+    read the rows from @a results from now on. iterators stay valid, so this may be called
+    while the view is attached, once the rows refer to @a results.
+*/
+void suggestion_model_set_results(GtkTreeModel* model, const CodeCompletionResults* results);
+}
@@ -24,6 +24,7 @@
 #include "cc_plugin.hpp"
 // for CodeCompletionResults
 #include "completion_base.hpp"
+#include "fuzzy_match.hpp"
 
 namespace geanycc
 {
@@ -38,25 +39,56 @@ class SuggestionWindow
 	void filter_add(const std::string& str);
 	void filter_backspace();
 
-	void show(const CodeCompletionResults& results, const char* initial_filter = NULL);
+	/// show @a results, which the window may describe but does not otherwise change.
+	/// @a provisional results stand in until the answer for this position arrives
+	void show(const CodeCompletionResultsPtr& results, const char* initial_filter = NULL,
+	          bool provisional = false);
 	// void show_with_filter(const cc::CodeCompletionResults& results, const std::string& filter);
 	void close();
 
 	bool is_showing() const { return showing_flag; }
+	/// true if the engine returned only the best of the candidates for the last request
+	bool has_partial_results() const
+	{
+		return !provisional && results->size() < results->total();
+	}
+	bool is_provisional() const { return provisional; }
 	void arrange_window();
 
 	int set_max_char_in_row(int num) { max_char_in_row = num; }
 	int set_max_window_height(int px) { max_window_height = px; }
 	int set_page_up_down_skip_amount(int amount) { page_up_down_skip_amount = amount; }
+	/// show only rows matching the filter as a fuzzy subsequence, best first
+	void set_fuzzy_filter(bool fuzzy);
 
    private:
 	GtkWidget* window;
 	GtkWidget* tree_view;
-	GtkListStore* model;
+	GtkTreeModel* model;  // over results, see suggestion_model.hpp
 
 	std::vector<GdkPixbuf*> icon_pixbufs;
 
+	CodeCompletionResultsPtr results;  // never null
+	std::vector<uint32_t> shown_rows;  // rows of results in the model, in order
+
+	// rows whose typed texts start with the first length bytes of filtered_str
+	struct FilterRange
+	{
+		size_t length;
+		size_t begin;  // into sorted_rows
+		size_t end;
+	};
+	std::vector<uint32_t> sorted_rows;  // rows ordered by typed text (byte-wise)
+	std::vector<FilterRange> filter_ranges;  // narrowing as the filter grows
+
+	bool fuzzy_filter = false;
+	FuzzyMatcher matcher;  // of the typed texts of results
+	std::vector<FuzzyMatcher::Match> matches;
+
+	std::vector<uint32_t> next_rows;  // to be shown by patch_rows()
+
 	bool showing_flag;
+	bool provisional = false;  // shown in italic
 
 	std::string filtered_str;
 	int pos_start;
@@ -73,13 +105,20 @@ class SuggestionWindow
 	                                             SuggestionWindow* self);
 	static gboolean signal_mouse_scroll(GtkWidget* widget, GdkEventScroll* event,
 	                                             SuggestionWindow* self);
+	static void render_label(GtkTreeViewColumn* column, GtkCellRenderer* cell,
+	                         GtkTreeModel* model, GtkTreeIter* iter, gpointer self);
 	static void signal_tree_selection(GtkTreeView* tree_view, GtkTreePath* path,
 	                                  GtkTreeViewColumn* column, SuggestionWindow* self);
 
 	void move_cursor(bool down);
 	void select_suggestion();
 	void do_filtering();
+	void do_fuzzy_filtering();
+	void build_filter_index();
+
+	void patch_rows(const CodeCompletionResults& old);
 
-	void setup_showing(const CodeCompletionResults& results);
+	void setup_showing(const CodeCompletionResultsPtr& new_results);
+	void update_showing(const CodeCompletionResultsPtr& new_results, const char* initial_filter);
 };
 } // namespace geanycc
@@ -21,9 +21,13 @@
 
 #include <geanycc/cc_plugin.hpp>
 #include <geanycc/completion_framework_base.hpp>
+#include <geanycc/cursor_context.hpp>
 
 #include <string>
 #include <vector>
+#include <atomic>
+#include <deque>
+#include <algorithm>
 #include <string.h>
 
 // global variables ////////////////////////////////////////////////////////////////
@@ -35,15 +39,40 @@ static struct
 {
 	bool valid;
 	int start_pos;
+	geanycc::CursorContextKind context;
+	std::string scope;  // see get_scope()
 	std::string text;
+	// of the request at start_pos. refines reuse it, clang answers them from its last results
+	geanycc::DocumentSnapshotPtr content;
 } edit_tracker;
+
+// true while a delivery of results is posted to the main loop
+static std::atomic<bool> delivery_posted(false);
+
+// the pending identifier trigger, 0 if none
+static guint auto_trigger_source = 0;
+
+// results recently shown, most recent first. they stand in while clang is slow.
+// shared with the window, each one keeps the raw results of its request alive, so keep few
+struct RecentResults
+{
+	std::string scope;
+	geanycc::CodeCompletionResultsPtr results;
+};
+static std::deque<RecentResults> recent_results;
+static const size_t RECENT_RESULTS_MAX = 4;
+
+// a set nobody else holds, which the next delivery fills
+static geanycc::CodeCompletionResultsPtr spare_results;
+
+// the deadline of the completion in flight, 0 if none
+static guint deadline_source = 0;
 ////////////////////////////////////////////////////////////////////////////////////
 /**
-    return true if the editing file needs completions, otherwise false. ( is it C/C++ file? )
+    return true if the file needs completions, otherwise false. ( is it C/C++ file? )
  */
-static bool is_completion_file_now()
+static bool is_completion_file(GeanyDocument* doc)
 {
-	GeanyDocument* doc = document_get_current();
 	if (doc == NULL) {
 		return false;
 	}
@@ -58,40 +87,209 @@ static bool is_completion_file_now()
 	}
 }
 
-static int get_completion_position(int* flag = NULL)
+/**
+    is_completion_file() of the last asked document, kept until a signal tells that its
+    filetype or path may have changed. editor notifications ask it for every keystroke.
+ */
+static struct
 {
-	const char* stop_token = "{}[]#()<>%:;.?*+-/^&∼!=,\\\"\'\t\n ";
-	float xxx;
-	GeanyDocument* doc = document_get_current();
+	GeanyDocument* doc;  // NULL if nothing is cached
+	guint id;            // document structs are reused by Geany, ids are not
+	bool eligible;
+} eligibility_cache;
+
+static bool is_completion_file_cached(GeanyDocument* doc)
+{
+	if (doc == NULL) {
+		return false;
+	}
+	if (doc != eligibility_cache.doc || doc->id != eligibility_cache.id) {
+		eligibility_cache.doc = doc;
+		eligibility_cache.id = doc->id;
+		eligibility_cache.eligible = is_completion_file(doc);
+	}
+	return eligibility_cache.eligible;
+}
+
+static void forget_eligibility() { eligibility_cache.doc = NULL; }
+
+/**
+    return true if the editing file needs completions, otherwise false.
+ */
+static bool is_completion_file_now()
+{
+	return is_completion_file_cached(document_get_current());
+}
+
+/**
+    copy the document once, straight from the Scintilla buffer.
+ */
+static geanycc::DocumentSnapshotPtr take_snapshot(ScintillaObject* sci)
+{
+	const char* text = (const char*)scintilla_send_message(sci, SCI_GETCHARACTERPOINTER, 0, 0);
+	return std::make_shared<const geanycc::DocumentSnapshot>(text, sci_get_length(sci));
+}
+
+static void request_completion(GeanyEditor* editor, geanycc::DocumentSnapshotPtr content,
+                               int flag);
+
+static inline bool is_qualifier_char(char c)
+{
+	return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') ||
+	       c == '_' || c == '.' || c == '-' || c == '>' || c == ':' || c == '/' || c == '<' ||
+	       c == '"';
+}
+
+/**
+    what completions at @a context depend on, roughly: the expression before . -> :: or the
+    directory of an #include, else the innermost fold block around a plain identifier.
+ */
+static std::string get_scope(GeanyEditor* editor, const geanycc::DocumentSnapshot& content,
+                             const geanycc::CursorContext& context)
+{
+	const int QUALIFIER_MAX = 64;
+	std::string scope = editor->document->file_name;
+	scope += '\n';
+	scope += (char)('0' + context.kind);
+	if (context.kind == geanycc::CURSOR_CONTEXT_IDENTIFIER) {
+		int line = sci_get_line_from_position(editor->sci, context.word_start);
+		int parent = scintilla_send_message(editor->sci, SCI_GETFOLDPARENT, line, 0);
+		scope += std::to_string(parent);
+	} else {
+		const char* data = content.data();
+		int limit = std::max(0, context.word_start - QUALIFIER_MAX);
+		int begin = context.word_start;
+		while (begin > limit && is_qualifier_char(data[begin - 1])) {
+			begin--;
+		}
+		scope.append(data + begin, context.word_start - begin);
+	}
+	return scope;
+}
+
+/// keep the set a dropped entry held as the spare, if the window does not show it
+static void drop_recent_results(std::deque<RecentResults>::iterator iter)
+{
+	geanycc::CodeCompletionResultsPtr dropped;
+	dropped.swap(iter->results);
+	recent_results.erase(iter);
+	if (dropped.use_count() == 1 && !spare_results) {
+		dropped->clear();
+		spare_results.swap(dropped);
+	}
+}
+
+/// those of a closed document are of no use any more
+static void forget_recent_results(const char* file_name)
+{
+	std::string prefix = file_name;
+	prefix += '\n';  // see get_scope()
+	for (size_t i = recent_results.size(); i-- > 0;) {
+		if (recent_results[i].scope.compare(0, prefix.length(), prefix) == 0) {
+			drop_recent_results(recent_results.begin() + i);
+		}
+	}
+}
 
-	ScintillaObject* sci = doc->editor->sci;
-	int cur_pos = sci_get_current_position(sci);
-	if (cur_pos == 0) return 0;
-	int cur_token_started_pos = 0;
-	// g_print("char at (%d) %c ", sci_get_char_at(sci, cur_pos), sci_get_char_at(sci, cur_pos));
-	for (int pos = cur_pos - 1; pos >= 0; pos--) {
-		if (strchr(stop_token, sci_get_char_at(sci, pos))) {
-			cur_token_started_pos = pos + 1;
+static void remember_results(const geanycc::CodeCompletionResultsPtr& results)
+{
+	if (results->empty()) {
+		return;
+	}
+	for (auto iter = recent_results.begin(); iter != recent_results.end(); ++iter) {
+		if (iter->scope == edit_tracker.scope && iter->results->prefix() == results->prefix()) {
+			drop_recent_results(iter);
 			break;
 		}
 	}
-	// g_print("cpos %d token %d", cur_pos, cur_token_started_pos);
-	return cur_token_started_pos;
+	RecentResults recent;
+	recent.scope = edit_tracker.scope;
+	recent.results = results;
+	recent_results.push_front(recent);
+	if (recent_results.size() > RECENT_RESULTS_MAX) {
+		drop_recent_results(recent_results.end() - 1);
+	}
+}
+
+static void cancel_deadline()
+{
+	if (deadline_source) {
+		g_source_remove(deadline_source);
+		deadline_source = 0;
+	}
+}
+
+/**
+    clang is late: show the latest results of the same scope, which still cover the typed text,
+    until its answer is patched in.
+ */
+static gboolean on_deadline(gpointer user_data)
+{
+	deadline_source = 0;
+	if (!edit_tracker.valid || suggestWindow->is_showing() || !is_completion_file_now()) {
+		return FALSE;
+	}
+	for (auto iter = recent_results.begin(); iter != recent_results.end(); ++iter) {
+		const std::string& prefix = iter->results->prefix();
+		if (iter->scope == edit_tracker.scope &&
+		    edit_tracker.text.compare(0, prefix.length(), prefix) == 0) {
+			suggestWindow->show(iter->results, edit_tracker.text.c_str(), true);
+			break;
+		}
+	}
+	return FALSE;
+}
+
+static void cancel_auto_trigger()
+{
+	if (auto_trigger_source) {
+		g_source_remove(auto_trigger_source);
+		auto_trigger_source = 0;
+	}
 }
 
 static void send_complete(GeanyEditor* editor, int flag)
 {
+	cancel_auto_trigger();
 	if (completion_framework == NULL) {
 		return;
 	}
 	if (!is_completion_file_now()) {
 		return;
 	}
-	int pos = get_completion_position();
-	if (pos == 0) {
+	geanycc::CursorContext context = geanycc::get_cursor_context(editor->sci);
+	int pos = context.word_start;
+	if (context.kind == geanycc::CURSOR_CONTEXT_NONE || pos == 0) {
 		return;
 	}  // nothing to complete
 
+	geanycc::DocumentSnapshotPtr content = take_snapshot(editor->sci);
+
+	// results for the same position are patched into the shown list, others start over
+	if (!edit_tracker.valid || edit_tracker.start_pos != pos) {
+		suggestWindow->close();
+	}
+	edit_tracker.valid = true;
+	edit_tracker.start_pos = pos;
+	edit_tracker.context = context.kind;
+	edit_tracker.scope = get_scope(editor, *content, context);
+	edit_tracker.text.clear();
+	edit_tracker.content = content;
+
+	if (pos != sci_get_current_position(editor->sci)) {
+		int len = sci_get_current_position(editor->sci) - pos;
+		edit_tracker.text.append(content->data() + pos, len);
+	}
+	request_completion(editor, content, flag);
+}
+
+/**
+    ask for the completions at the tracked position, filtered by the text typed after it.
+ */
+static void request_completion(GeanyEditor* editor, geanycc::DocumentSnapshotPtr content,
+                               int flag)
+{
+	int pos = edit_tracker.start_pos;
 	int line = sci_get_line_from_position(editor->sci, pos);
 	int ls_pos = sci_get_position_from_line(editor->sci, line);
 	int byte_line_len = pos - ls_pos;
@@ -99,24 +297,15 @@ static void send_complete(GeanyEditor* editor, int flag)
 		return;
 	}
 
-	char* content = sci_get_contents(editor->sci, sci_get_length(editor->sci) + 1 + 1);
-	content[sci_get_length(editor->sci)] = ' ';  // replace null -> virtual space for clang
-	content[sci_get_length(editor->sci)] = '\0';
-
 	// TODO clang's col is byte? character?
 	completion_framework->complete_async(editor->document->file_name, content, line + 1,
-	                                     byte_line_len + 1);
+	                                     byte_line_len + 1, edit_tracker.text.c_str(), flag);
 
-	edit_tracker.valid = true;
-	edit_tracker.start_pos = pos;
-	edit_tracker.text.clear();
-
-	if (pos != sci_get_current_position(editor->sci)) {
-		int len = sci_get_current_position(editor->sci) - pos;
-		edit_tracker.text.append(content + pos, len);
+	int deadline = completion_framework->get_completion_deadline();
+	if (deadline > 0 && !(flag & geanycc::COMPLETE_FLAG_REFINE)) {
+		cancel_deadline();
+		deadline_source = g_timeout_add(deadline, on_deadline, NULL);
 	}
-
-	g_free(content);
 }
 
 /**
@@ -131,10 +320,73 @@ static bool check_trigger_char(GeanyEditor* editor)
 	}
 }
 
+/**
+    return true if the caret is after enough identifier characters of a word which has not
+    been completed yet, otherwise false.
+ */
+static bool check_auto_trigger(GeanyEditor* editor)
+{
+	int chars = completion_framework->get_auto_trigger_chars();
+	if (chars <= 0) {
+		return false;
+	}
+	geanycc::CursorContext context = geanycc::get_cursor_context(editor->sci);
+	if (context.kind != geanycc::CURSOR_CONTEXT_IDENTIFIER) {
+		return false;  // the others start with trigger characters
+	}
+	if (sci_get_current_position(editor->sci) - context.word_start < chars) {
+		return false;
+	}
+	if (edit_tracker.valid && edit_tracker.start_pos == context.word_start) {
+		return false;  // asked already, typing filters those results
+	}
+	char first = sci_get_char_at(editor->sci, context.word_start);
+	if ('0' <= first && first <= '9') {
+		return false;
+	}
+	return completion_framework->check_identifier_trigger(editor);
+}
+
+static gboolean fire_auto_trigger(gpointer user_data)
+{
+	GeanyDocument* doc = document_get_current();
+	if (completion_framework == NULL || !is_completion_file_cached(doc)) {
+		auto_trigger_source = 0;
+		return FALSE;
+	}
+	if (completion_framework->is_completion_busy()) {
+		return TRUE;  // do not queue behind a running completion, wait one more period
+	}
+	auto_trigger_source = 0;
+	if (check_auto_trigger(doc->editor)) {
+		send_complete(doc->editor, 0);
+	}
+	return FALSE;
+}
+
+/**
+    (re)start the debounce of the identifier trigger. the period follows how long completion
+    takes in this document, so a slow translation unit gets asked at most about once per
+    completion while typing, and a fast one is asked almost at once.
+ */
+static void schedule_auto_trigger(GeanyEditor* editor)
+{
+	const int MIN_DELAY_MS = 30;
+	const int MAX_DELAY_MS = 600;
+
+	cancel_auto_trigger();
+	if (!check_auto_trigger(editor)) {
+		return;
+	}
+	int latency = completion_framework->get_completion_latency(editor->document->file_name);
+	int delay = std::min(MIN_DELAY_MS + std::max(latency, 0), MAX_DELAY_MS);
+	auto_trigger_source = g_timeout_add(delay, fire_auto_trigger, NULL);
+}
+
 static gboolean on_editor_notify(GObject* obj, GeanyEditor* editor, SCNotification* nt,
                                  gpointer* user_data)
 {
-	if (!is_completion_file_now()) {
+	if (!is_completion_file_cached(editor->document)) {
 		return FALSE;
 	}
 	switch (nt->nmhdr.code) {
@@ -151,6 +403,11 @@ static gboolean on_editor_notify(GObject* obj, GeanyEditor* editor, SCNotificati
 					if (nt->position == edit_tracker.start_pos + edit_tracker.text.length()) {
 						std::string text(nt->text, nt->length);  // nt->text is not null term
 						edit_tracker.text += text;
+						if (suggestWindow->has_partial_results()) {
+							// the best of the longer prefix may not be in the shown rows
+							request_completion(editor, edit_tracker.content,
+							                   geanycc::COMPLETE_FLAG_REFINE);
+						}
 						suggestWindow->filter_add(text.c_str());
 					} else {
 						edit_tracker.valid = false;
@@ -173,6 +430,8 @@ static gboolean on_editor_notify(GObject* obj, GeanyEditor* editor, SCNotificati
 		case SCN_CHARADDED:
 			if (check_trigger_char(editor)) {
 				send_complete(editor, FALSE);
+			} else if (completion_framework) {
+				schedule_auto_trigger(editor);
 			}
 			break;
 		default:
@@ -181,11 +440,56 @@ static gboolean on_editor_notify(GObject* obj, GeanyEditor* editor, SCNotificati
 	return FALSE;
 }
 
+/**
+    start parsing the document in the background, so that a translation unit is ready
+    when the first trigger character is typed. documents the user has not turned to yet are
+    parsed as idle jobs, only when nothing else waits.
+ */
+static void warm_up(GeanyDocument* doc, geanycc::JobPriority priority = geanycc::JOB_WARMUP)
+{
+	if (completion_framework == NULL || !is_completion_file(doc)) {
+		return;
+	}
+	completion_framework->prepare_async(doc->file_name, take_snapshot(doc->editor->sci),
+	                                    priority);
+}
+
 static void on_document_activate(GObject* obj, GeanyDocument* doc, gpointer user_data)
 {
+	forget_eligibility();
 	if (suggestWindow) {
 		suggestWindow->close();
 	}
+	warm_up(doc);
+}
+
+static void on_document_open(GObject* obj, GeanyDocument* doc, gpointer user_data)
+{
+	// e.g. a session being restored. the active one is raised by document_activate
+	warm_up(doc, geanycc::JOB_IDLE);
+}
+
+static void on_document_filetype_set(GObject* obj, GeanyDocument* doc,
+                                     GeanyFiletype* filetype_old, gpointer user_data)
+{
+	forget_eligibility();
+}
+
+/// also called after "save as", which gives a new document its real path
+static void on_document_save(GObject* obj, GeanyDocument* doc, gpointer user_data)
+{
+	forget_eligibility();
+}
+
+static void on_document_close(GObject* obj, GeanyDocument* doc, gpointer user_data)
+{
+	forget_eligibility();
+	if (doc->file_name) {
+		forget_recent_results(doc->file_name);
+	}
+	if (completion_framework && is_completion_file(doc)) {
+		completion_framework->release_async(doc->file_name);
+	}
 }
 
 static void force_completion(guint key_id)
@@ -198,20 +502,44 @@ static void force_completion(guint key_id)
 	}
 }
 
-static gboolean loop_check_ready(gpointer user_data)
+/**
+    runs on the main loop when the worker has results ready.
+ */
+static gboolean deliver_results(gpointer user_data)
 {
+	delivery_posted = false;
 	if (!is_completion_file_now()) {
-		return TRUE;
+		return FALSE;
 	}
 	if (completion_framework) {
-		geanycc::CodeCompletionResults results;  // allocate at heap, when init?
-		if (completion_framework->try_get_completion_results(results)) {
+		// swapped with the worker's results, so both containers keep their capacity
+		if (!spare_results) {
+			spare_results.reset(new geanycc::CodeCompletionResults());
+		}
+		if (completion_framework->try_get_completion_results(*spare_results)) {
+			cancel_deadline();
 			if (edit_tracker.valid) {
+				geanycc::CodeCompletionResultsPtr results;
+				results.swap(spare_results);
+				remember_results(results);
+				// replaces provisional rows in place
 				suggestWindow->show(results, edit_tracker.text.c_str());
+			} else {
+				spare_results->clear();  // lets the engine free its raw results
 			}
 		}
 	}
-	return TRUE;
+	return FALSE;
+}
+
+/**
+    called on the worker thread. wakes the main loop only when there is something to show.
+ */
+static void post_results_ready()
+{
+	if (!delivery_posted.exchange(true)) {
+		g_idle_add(deliver_results, &delivery_posted);
+	}
 }
 
 static void init_keybindings()
@@ -230,7 +558,7 @@ void plugin_init(GeanyData* data)
 {
 	completion_framework = geanycc::create_lang_completion_framework();
 
-	plugin_timeout_add(geany_plugin, 20, loop_check_ready, NULL);
+	completion_framework->set_results_ready_callback(post_results_ready);
 	suggestWindow = new geanycc::SuggestionWindow();
 	completion_framework->set_suggestion_window(suggestWindow);
 	completion_framework->load_preferences();
@@ -238,14 +566,29 @@ void plugin_init(GeanyData* data)
 	init_keybindings();
 
 	edit_tracker.valid = false;
+	forget_eligibility();
+
+	// documents opened before the plugin was enabled
+	guint i;
+	foreach_document(i)
+	{
+		warm_up(documents[i], geanycc::JOB_IDLE);
+	}
+	warm_up(document_get_current());
 }
 
 void plugin_cleanup(void)
 {
 	if (completion_framework) {
-		delete completion_framework;
+		delete completion_framework;  // stops the worker
 		completion_framework = NULL;
 	}
+	g_idle_remove_by_data(&delivery_posted);
+	cancel_auto_trigger();
+	cancel_deadline();
+	recent_results.clear();
+	spare_results.reset();
+	edit_tracker.content.reset();
 	if (suggestWindow) {
 		delete suggestWindow;
 		suggestWindow = NULL;
@@ -263,7 +606,10 @@ GeanyData* geany_data;
 PluginCallback plugin_callbacks[] = {
     {"editor_notify", (GCallback) & on_editor_notify, FALSE, NULL},
     {"document_activate", (GCallback) & on_document_activate, FALSE, NULL},
-    //{"document_open", (GCallback)&on_document_open, FALSE, NULL},
+    {"document_open", (GCallback) & on_document_open, FALSE, NULL},
+    {"document_filetype_set", (GCallback) & on_document_filetype_set, FALSE, NULL},
+    {"document_save", (GCallback) & on_document_save, FALSE, NULL},
+    {"document_close", (GCallback) & on_document_close, FALSE, NULL},
     {NULL, NULL, FALSE, NULL}};
 
 }
@@ -21,27 +21,38 @@
 
 #include <geanycc/completion_async.hpp>
 #include <geanycc/completion_base.hpp>
+#include <geanycc/job_scheduler.hpp>
 #include <thread>
 #include <mutex>
-#include <list>
-#include <algorithm>
 #include <memory>
-#include <future>
-#include <iostream>
+#include <cstdint>
 #include <chrono>
+#include <map>
+#include <algorithm>
 
 namespace geanycc
 {
+/**
+    completions are interactive jobs of the scheduler under one key, so a newer request
+    replaces one that has not started yet and only the latest keystroke is completed.
+    every request carries a generation number and results of any request but the latest
+    are dropped. parses ahead are warm-up or idle jobs keyed by file. the engine locks each
+    translation unit, so work in different files runs in parallel.
+*/
 class CodeCompletionAsyncWrapper::CodeCompletionAsyncWrapperImpl
 {
    public:
 	CodeCompletionAsyncWrapperImpl(CodeCompletionBase* completion)
+	    : completion(completion), scheduler(new JobScheduler(JobScheduler::default_workers()))
 	{
-		this->completion = completion;
 	}
 
 	~CodeCompletionAsyncWrapperImpl()
 	{
+		if (completion) {
+			completion->cancel();
+		}
+		scheduler.reset();  // waits for running jobs
 		if (completion) {
 			delete completion;
 			completion = nullptr;
@@ -50,59 +61,142 @@ class CodeCompletionAsyncWrapper::CodeCompletionAsyncWrapperImpl
 
 	void set_option(std::vector<std::string>& options)
 	{
-		std::lock_guard<std::mutex> lock(comp_mutex);
-		completion->set_option(options);
+		scheduler->run_exclusive([this, &options]() { completion->set_option(options); });
+	}
+	void set_settings(const CodeCompletionSettings& settings)
+	{
+		scheduler->run_exclusive([this, &settings]() { completion->set_settings(settings); });
+	}
+	void complete_async(const char* filename, DocumentSnapshotPtr content, int line, int col,
+	                    const char* prefix, int flag)
+	{
+		std::shared_ptr<CompletionRequest> request(new CompletionRequest());
+		request->filename = filename;
+		request->content = content;
+		request->line = line;
+		request->col = col;
+		request->prefix = prefix;
+		request->flag = flag;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			request->generation = ++requested_generation;
+		}
+		completion->cancel();  // before posting, so that it cannot hit the new request
+		scheduler->post(JOB_INTERACTIVE, "", [this, request]() { complete(*request); });
 	}
-	void complete_async(const char* filename, const char* content, int line, int col, int flag)
+
+	void prepare_async(const char* filename, DocumentSnapshotPtr content, JobPriority priority)
 	{
-		std::string filename_(filename);
-		std::string content_(content);
+		std::string file(filename);
+		scheduler->post(priority, file, [this, file, content]() {
+			completion->prepare(file.c_str(), *content);
+		});
+	}
+
+	void release_async(const char* filename)
+	{
+		std::string file(filename);
+		scheduler->post(JOB_WARMUP, file, [this, file]() { completion->release(file.c_str()); });
+	}
 
-		std::shared_ptr<CodeCompletionResults> p(new CodeCompletionResults());
+	void set_ready_callback(std::function<void()> callback)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		ready_callback = callback;
+	}
 
-		std::future<std::shared_ptr<CodeCompletionResults> > f = std::async(
-		    std::launch::async, [=](std::shared_ptr<CodeCompletionResults> results) {
-			                        std::lock_guard<std::mutex> lock(comp_mutex);
+	bool is_busy()
+	{
+		return scheduler->get_queue_depth(JOB_INTERACTIVE) != 0 ||
+		       scheduler->get_running(JOB_INTERACTIVE) != 0;
+	}
 
-			                        completion->complete(*results, filename_.c_str(),
-			                                             content_.c_str(), line, col, flag);
-			                        return results;
-			                    },
-		    p);
+	size_t get_queue_depth(JobPriority priority) { return scheduler->get_queue_depth(priority); }
 
-		// push front (stack)
-		future_list.push_front(std::move(f));
+	int get_latency(const char* filename)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto iter = latencies.find(filename);
+		return iter != latencies.end() ? iter->second : -1;
 	}
 
 	bool try_get_results(CodeCompletionResults& results)
 	{
-		if (future_list.empty()) {
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!ready_results || ready_generation != requested_generation) {
 			return false;
+		}
+		results.swap(*ready_results);  // hand over, no copy
+		// the caller's previous results come back, to be filled by the next request
+		spare_results = ready_results;
+		ready_results.reset();
+		return true;
+	}
+
+   private:
+	struct CompletionRequest
+	{
+		uint64_t generation;
+		std::string filename;
+		DocumentSnapshotPtr content;
+		int line;
+		int col;
+		std::string prefix;
+		int flag;
+	};
+
+	/// runs on a worker
+	void complete(const CompletionRequest& request)
+	{
+		std::shared_ptr<CodeCompletionResults> results;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			results.swap(spare_results);
+		}
+		if (results) {
+			results->clear();  // keeps the capacity
 		} else {
-			bool ret = 0;
-			auto iter = future_list.begin();
-
-			if (iter->wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
-				results = *(iter->get());  // copy
-				ret = true;
-				future_list.erase(iter);
-
-				future_list.remove_if([](std::future<std::shared_ptr<CodeCompletionResults> >& f) {
-					return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
-				});
-			} else {
-				ret = false;
+			results.reset(new CodeCompletionResults());
+		}
+		auto started = std::chrono::steady_clock::now();
+		completion->complete(*results, request.filename.c_str(), *request.content, request.line,
+		                     request.col, request.prefix.c_str(), request.flag);
+		int elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+		                  std::chrono::steady_clock::now() - started).count();
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!(request.flag & COMPLETE_FLAG_REFINE)) {  // refining does not reparse
+			update_latency(request.filename, elapsed);
+		}
+		if (request.generation == requested_generation) {
+			ready_results = results;
+			ready_generation = request.generation;
+			if (ready_callback) {
+				ready_callback();
 			}
-			return ret;
 		}
 	}
 
-   private:
-	CodeCompletionBase* completion = nullptr;
+	/// a moving average, so one slow reparse does not throttle typing for long
+	void update_latency(const std::string& filename, int elapsed)
+	{
+		auto iter = latencies.find(filename);
+		if (iter == latencies.end()) {
+			latencies[filename] = elapsed;
+		} else {
+			iter->second = (iter->second * 3 + elapsed) / 4;
+		}
+	}
 
-	std::list<std::future<std::shared_ptr<CodeCompletionResults> > > future_list;
+	CodeCompletionBase* completion = nullptr;
+	std::unique_ptr<JobScheduler> scheduler;
 
-	std::mutex comp_mutex;
+	std::mutex mutex;  // guards the members below
+	std::map<std::string, int> latencies;  // by filename, in milliseconds
+	uint64_t requested_generation = 0;
+	uint64_t ready_generation = 0;
+	std::shared_ptr<CodeCompletionResults> ready_results;
+	std::shared_ptr<CodeCompletionResults> spare_results;
+	std::function<void()> ready_callback;
 };
 
 CodeCompletionAsyncWrapper::CodeCompletionAsyncWrapper(CodeCompletionBase* completion)
@@ -117,10 +211,43 @@ void CodeCompletionAsyncWrapper::set_option(std::vector<std::string>& options)
 	pimpl->set_option(options);
 }
 
-void CodeCompletionAsyncWrapper::complete_async(const char* filename, const char* content, int line,
-                                                int col, int flag)
+void CodeCompletionAsyncWrapper::complete_async(const char* filename, DocumentSnapshotPtr content,
+                                                int line, int col, const char* prefix, int flag)
+{
+	pimpl->complete_async(filename, content, line, col, prefix, flag);
+}
+
+void CodeCompletionAsyncWrapper::set_settings(const CodeCompletionSettings& settings)
+{
+	pimpl->set_settings(settings);
+}
+
+void CodeCompletionAsyncWrapper::prepare_async(const char* filename, DocumentSnapshotPtr content,
+                                               JobPriority priority)
+{
+	pimpl->prepare_async(filename, content, priority);
+}
+
+void CodeCompletionAsyncWrapper::release_async(const char* filename)
+{
+	pimpl->release_async(filename);
+}
+
+void CodeCompletionAsyncWrapper::set_ready_callback(std::function<void()> callback)
+{
+	pimpl->set_ready_callback(callback);
+}
+
+bool CodeCompletionAsyncWrapper::is_busy() { return pimpl->is_busy(); }
+
+size_t CodeCompletionAsyncWrapper::get_queue_depth(JobPriority priority)
+{
+	return pimpl->get_queue_depth(priority);
+}
+
+int CodeCompletionAsyncWrapper::get_latency(const char* filename)
 {
-	pimpl->complete_async(filename, content, line, col, flag);
+	return pimpl->get_latency(filename);
 }
 
 bool CodeCompletionAsyncWrapper::try_get_results(CodeCompletionResults& results)
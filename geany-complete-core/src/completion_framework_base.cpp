@@ -24,6 +24,17 @@
 namespace geanycc
 {
 
+void CompletionFrameworkBase::set_engine(CodeCompletionBase* engine)
+{
+	if (completion) {
+		delete completion;
+	}
+	completion = new CodeCompletionAsyncWrapper(engine);
+	if (ready_callback) {
+		completion->set_ready_callback(ready_callback);
+	}
+}
+
 void CompletionFrameworkBase::set_completion_option(std::vector<std::string>& options)
 {
 	if (completion) {
@@ -31,11 +42,41 @@ void CompletionFrameworkBase::set_completion_option(std::vector<std::string>& op
 	}
 }
 
-void CompletionFrameworkBase::complete_async(const char* filename, const char* content, int line,
-                                            int col, int flag)
+void CompletionFrameworkBase::set_completion_settings(const CodeCompletionSettings& settings)
 {
 	if (completion) {
-		completion->complete_async(filename, content, line, col, flag);
+		completion->set_settings(settings);
+	}
+}
+
+void CompletionFrameworkBase::complete_async(const char* filename, DocumentSnapshotPtr content,
+                                            int line, int col, const char* prefix, int flag)
+{
+	if (completion) {
+		completion->complete_async(filename, content, line, col, prefix, flag);
+	}
+}
+
+void CompletionFrameworkBase::prepare_async(const char* filename, DocumentSnapshotPtr content,
+                                            JobPriority priority)
+{
+	if (completion) {
+		completion->prepare_async(filename, content, priority);
+	}
+}
+
+void CompletionFrameworkBase::release_async(const char* filename)
+{
+	if (completion) {
+		completion->release_async(filename);
+	}
+}
+
+void CompletionFrameworkBase::set_results_ready_callback(std::function<void()> callback)
+{
+	ready_callback = callback;
+	if (completion) {
+		completion->set_ready_callback(callback);
 	}
 }
 
@@ -48,6 +89,33 @@ bool CompletionFrameworkBase::try_get_completion_results(CodeCompletionResults&
 	}
 }
 
+bool CompletionFrameworkBase::is_completion_busy()
+{
+	if (completion) {
+		return completion->is_busy();
+	} else {
+		return false;
+	}
+}
+
+int CompletionFrameworkBase::get_completion_latency(const char* filename)
+{
+	if (completion) {
+		return completion->get_latency(filename);
+	} else {
+		return -1;
+	}
+}
+
+size_t CompletionFrameworkBase::get_queue_depth(JobPriority priority)
+{
+	if (completion) {
+		return completion->get_queue_depth(priority);
+	} else {
+		return 0;
+	}
+}
+
 std::string CompletionFrameworkBase::get_config_file()
 {
 	std::string config_file = geany_data->app->configdir;
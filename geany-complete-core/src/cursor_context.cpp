@@ -0,0 +1,130 @@
+/*
+ * cursor_context.cpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+
+#include <geanycc/cursor_context.hpp>
+
+#include <string.h>
+
+namespace geanycc
+{
+namespace
+{
+const char* STOP_CHARS = "{}[]#()<>%:;.?*+-/^&~!=,\\\"\'\t\n ";
+
+// one lookup per character instead of strchr
+struct StopTable
+{
+	bool stop[256];
+	StopTable()
+	{
+		memset(stop, 0, sizeof(stop));
+		for (const char* p = STOP_CHARS; *p; p++) {
+			stop[(unsigned char)*p] = true;
+		}
+	}
+};
+const StopTable stop_table;
+
+inline bool is_stop(char c) { return stop_table.stop[(unsigned char)c]; }
+inline bool is_space(char c) { return c == ' ' || c == '\t'; }
+
+int skip_spaces(const char* text, int pos, int length)
+{
+	while (pos < length && is_space(text[pos])) {
+		pos++;
+	}
+	return pos;
+}
+
+/// true if @a text is "#include <" or "#include \"" followed by an unclosed file name
+bool in_include(const char* text, int length)
+{
+	int pos = skip_spaces(text, 0, length);
+	if (pos >= length || text[pos] != '#') {
+		return false;
+	}
+	pos = skip_spaces(text, pos + 1, length);
+	int directive = pos;
+	while (pos < length && (('a' <= text[pos] && text[pos] <= 'z') || text[pos] == '_')) {
+		pos++;
+	}
+	int directive_length = pos - directive;
+	if (!(directive_length == 7 && strncmp(text + directive, "include", 7) == 0) &&
+	    !(directive_length == 12 && strncmp(text + directive, "include_next", 12) == 0) &&
+	    !(directive_length == 6 && strncmp(text + directive, "import", 6) == 0)) {
+		return false;
+	}
+	pos = skip_spaces(text, pos, length);
+	if (pos >= length || (text[pos] != '<' && text[pos] != '"')) {
+		return false;
+	}
+	char close = (text[pos] == '<') ? '>' : '"';
+	return memchr(text + pos + 1, close, length - pos - 1) == NULL;
+}
+}  // namespace
+
+CursorContext analyse_cursor_context(const char* text, int length, int text_pos,
+                                     bool at_line_start)
+{
+	CursorContext context = {CURSOR_CONTEXT_NONE, text_pos + length};
+	int start = length;
+	while (start > 0 && !is_stop(text[start - 1])) {
+		start--;
+	}
+	if (start == 0 && !at_line_start) {
+		return context;  // e.g. a minified line, the word may go on before the lookback
+	}
+	context.word_start = text_pos + start;
+
+	if (start >= 1 && text[start - 1] == '.') {
+		context.kind = CURSOR_CONTEXT_MEMBER;
+	} else if (start >= 2 && text[start - 2] == '-' && text[start - 1] == '>') {
+		context.kind = CURSOR_CONTEXT_MEMBER;
+	} else if (start >= 2 && text[start - 2] == ':' && text[start - 1] == ':') {
+		context.kind = CURSOR_CONTEXT_SCOPE;
+	} else if (at_line_start && in_include(text, length)) {
+		context.kind = CURSOR_CONTEXT_INCLUDE;
+	} else {
+		context.kind = CURSOR_CONTEXT_IDENTIFIER;
+	}
+	return context;
+}
+
+CursorContext get_cursor_context(ScintillaObject* sci)
+{
+	int cur_pos = sci_get_current_position(sci);
+	int from = sci_get_position_from_line(sci, sci_get_line_from_position(sci, cur_pos));
+	bool at_line_start = true;
+	if (cur_pos - from > CURSOR_CONTEXT_LOOKBACK) {
+		from = cur_pos - CURSOR_CONTEXT_LOOKBACK;
+		at_line_start = false;
+	}
+	// only this range is made contiguous, not the whole document
+	const char* text =
+	    (const char*)scintilla_send_message(sci, SCI_GETRANGEPOINTER, from, cur_pos - from);
+	if (text == NULL) {
+		CursorContext none = {CURSOR_CONTEXT_NONE, cur_pos};
+		return none;
+	}
+	return analyse_cursor_context(text, cur_pos - from, from, at_line_start);
+}
+}
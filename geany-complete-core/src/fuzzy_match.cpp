@@ -0,0 +1,205 @@
+/*
+ * fuzzy_match.cpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <geanycc/fuzzy_match.hpp>
+
+#include <algorithm>
+
+namespace geanycc
+{
+namespace
+{
+const size_t NOT_FOUND = (size_t)-1;
+
+// scores of a matched character
+const int MATCH_SCORE = 16;
+const int WORD_START_BONUS = 24;
+const int CONSECUTIVE_BONUS = 16;
+const int FIRST_CHAR_BONUS = 16;
+const int SAME_CASE_BONUS = 4;
+const int HUMP_MISMATCH_PENALTY = 16;  // an upper case query character is meant as a hump
+const int MAX_GAP_PENALTY = 8;
+const int PREFIX_BONUS = 32;  // the query is a plain prefix
+
+inline char fold(char c) { return ('A' <= c && c <= 'Z') ? c - 'A' + 'a' : c; }
+inline bool is_lower(char c) { return 'a' <= c && c <= 'z'; }
+inline bool is_upper(char c) { return 'A' <= c && c <= 'Z'; }
+inline bool is_alnum(char c)
+{
+	return is_lower(c) || is_upper(c) || ('0' <= c && c <= '9');
+}
+
+/// one bit per letter (case folded), digit and '_', other bytes share the rest
+inline uint64_t char_bit(char c)
+{
+	unsigned char f = (unsigned char)fold(c);
+	if ('a' <= f && f <= 'z') {
+		return 1ULL << (f - 'a');
+	} else if ('0' <= f && f <= '9') {
+		return 1ULL << (26 + f - '0');
+	} else if (f == '_') {
+		return 1ULL << 36;
+	}
+	return 1ULL << (37 + f % 27);
+}
+
+uint64_t char_mask(const char* text, size_t length)
+{
+	uint64_t mask = 0;
+	for (size_t i = 0; i < length; i++) {
+		mask |= char_bit(text[i]);
+	}
+	return mask;
+}
+
+inline bool is_word_start(const char* text, size_t pos)
+{
+	return pos == 0 || !is_alnum(text[pos - 1]) ||
+	       (is_upper(text[pos]) && is_lower(text[pos - 1]));
+}
+
+/**
+    match the query from left to right. with @a prefer_word_start, a character is taken
+    from the next word start where it occurs rather than from the nearest position, unless
+    it continues the previous match. return false if a character is not found.
+*/
+bool score_path(const char* query, size_t query_length, const char* text, size_t text_length,
+                bool prefer_word_start, int& score)
+{
+	score = 0;
+	size_t next = 0;
+	size_t prev = NOT_FOUND;
+	for (size_t q = 0; q < query_length; q++) {
+		char c = fold(query[q]);
+		size_t nearest = NOT_FOUND;
+		size_t word_start = NOT_FOUND;
+		for (size_t i = next; i < text_length; i++) {
+			if (fold(text[i]) != c) {
+				continue;
+			}
+			if (nearest == NOT_FOUND) {
+				nearest = i;
+				if (!prefer_word_start || (prev != NOT_FOUND && i == prev + 1)) {
+					break;
+				}
+			}
+			if (is_word_start(text, i)) {
+				word_start = i;
+				break;
+			}
+		}
+		if (nearest == NOT_FOUND) {
+			return false;
+		}
+		bool continues = (prev != NOT_FOUND && nearest == prev + 1);
+		size_t pos = (word_start != NOT_FOUND && !continues) ? word_start : nearest;
+
+		score += MATCH_SCORE;
+		if (is_word_start(text, pos)) {
+			score += WORD_START_BONUS;
+		}
+		if (pos == 0) {
+			score += FIRST_CHAR_BONUS;
+		}
+		if (prev != NOT_FOUND && pos == prev + 1) {
+			score += CONSECUTIVE_BONUS;
+		}
+		if (text[pos] == query[q]) {
+			score += SAME_CASE_BONUS;
+		} else if (is_upper(query[q])) {
+			score -= HUMP_MISMATCH_PENALTY;
+		}
+		size_t gap = pos - (prev == NOT_FOUND ? 0 : prev + 1);
+		score -= (int)std::min<size_t>(gap, MAX_GAP_PENALTY);
+		prev = pos;
+		next = pos + 1;
+	}
+	if (prev + 1 == query_length) {
+		score += PREFIX_BONUS;
+	}
+	// shorter names first among equal matches
+	score -= (int)std::min<size_t>((text_length - query_length) / 4, MAX_GAP_PENALTY);
+	return true;
+}
+}  // namespace
+
+bool fuzzy_match(const char* query, size_t query_length, const char* text, size_t text_length,
+                 int& score)
+{
+	if (query_length > text_length) {
+		return false;
+	}
+	// jumping to word starts may skip characters the rest of the query needs
+	return score_path(query, query_length, text, text_length, true, score) ||
+	       score_path(query, query_length, text, text_length, false, score);
+}
+
+void FuzzyMatcher::clear()
+{
+	masks.clear();
+	offsets.assign(1, 0);
+	arena.clear();
+}
+
+void FuzzyMatcher::reserve(size_t candidates, size_t text_bytes)
+{
+	masks.reserve(candidates);
+	offsets.reserve(candidates + 1);
+	arena.reserve(text_bytes);
+}
+
+void FuzzyMatcher::add(const char* text, size_t length)
+{
+	masks.push_back(char_mask(text, length));
+	arena.insert(arena.end(), text, text + length);
+	offsets.push_back(arena.size());
+}
+
+void FuzzyMatcher::match(const std::string& query, std::vector<Match>& matches)
+{
+	matches.clear();
+	const uint64_t query_mask = char_mask(query.c_str(), query.length());
+	const size_t n = masks.size();
+
+	// branch free over the packed masks, so that the compiler can vectorize it
+	passed.resize(n);
+	const uint64_t* mask = masks.data();
+	uint8_t* pass = passed.data();
+	for (size_t i = 0; i < n; i++) {
+		pass[i] = (mask[i] & query_mask) == query_mask;
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		if (!pass[i]) {
+			continue;
+		}
+		int score;
+		if (fuzzy_match(query.c_str(), query.length(), arena.data() + offsets[i],
+		                offsets[i + 1] - offsets[i], score)) {
+			Match m = {score, (uint32_t)i};
+			matches.push_back(m);
+		}
+	}
+	std::sort(matches.begin(), matches.end(), [](const Match& a, const Match& b) {
+		return a.score != b.score ? a.score > b.score : a.index < b.index;
+	});
+}
+}
@@ -0,0 +1,261 @@
+/*
+ * job_scheduler.cpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <geanycc/job_scheduler.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace geanycc
+{
+static const int BACKGROUND_NICE = 10;
+static const size_t SATURATION_DEPTH = 8;  // queued jobs worth reporting
+static const size_t MAX_WORKERS = 4;
+
+static const char* const PRIORITY_NAMES[JOB_PRIORITY_COUNT] = {"interactive", "warm-up", "idle"};
+
+class JobScheduler::JobSchedulerImpl
+{
+   public:
+	explicit JobSchedulerImpl(size_t count)
+	{
+		if (count == 0) {
+			count = 1;
+		}
+		for (size_t i = 0; i < count; i++) {
+			// the first worker serves interactive jobs, or everything if it is the only one
+			bool interactive = (i == 0);
+			bool background = (count == 1 || i != 0);
+			workers.push_back(std::thread([this, interactive, background]() {
+				run(interactive, background);
+			}));
+		}
+	}
+
+	~JobSchedulerImpl()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		wakeup.notify_all();
+		for (size_t i = 0; i < workers.size(); i++) {
+			workers[i].join();
+		}
+	}
+
+	void post(JobPriority priority, const std::string& key, Job job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			for (int p = 0; p < JOB_PRIORITY_COUNT; p++) {
+				if ((p == JOB_INTERACTIVE) != (priority == JOB_INTERACTIVE)) {
+					continue;  // keys of interactive jobs are apart from the others
+				}
+				std::deque<Entry>& queue = queues[p];
+				for (auto iter = queue.begin(); iter != queue.end(); ++iter) {
+					if (iter->key == key) {
+						queue.erase(iter);  // superseded
+						priority = std::min(priority, (JobPriority)p);
+						break;
+					}
+				}
+			}
+			Entry entry = {key, job};
+			queues[priority].push_back(entry);
+			report_saturation();
+		}
+		wakeup.notify_all();
+	}
+
+	void run_exclusive(const std::function<void()>& f)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		exclusive++;  // no job starts from now
+		idle.wait(lock, [this]() { return running_total == 0; });
+		f();
+		exclusive--;
+		lock.unlock();
+		wakeup.notify_all();
+	}
+
+	size_t get_queue_depth(JobPriority priority)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return queues[priority].size();
+	}
+
+	size_t get_running(JobPriority priority)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return running[priority];
+	}
+
+   private:
+	struct Entry
+	{
+		std::string key;
+		Job job;
+	};
+
+	/// the class of the next job for a worker, or -1 if none may start. call with mutex.
+	int pick(bool interactive, bool background)
+	{
+		if (exclusive != 0) {
+			return -1;
+		}
+		if (interactive && !queues[JOB_INTERACTIVE].empty() && running[JOB_INTERACTIVE] == 0) {
+			return JOB_INTERACTIVE;
+		}
+		if (!background) {
+			return -1;
+		}
+		if (find_startable(JOB_WARMUP) != queues[JOB_WARMUP].end()) {
+			return JOB_WARMUP;
+		}
+		if (queues[JOB_INTERACTIVE].empty() && queues[JOB_WARMUP].empty() &&
+		    find_startable(JOB_IDLE) != queues[JOB_IDLE].end()) {
+			return JOB_IDLE;
+		}
+		return -1;
+	}
+
+	/// the first queued job whose key is not running. call with mutex.
+	std::deque<Entry>::iterator find_startable(JobPriority priority)
+	{
+		std::deque<Entry>& queue = queues[priority];
+		for (auto iter = queue.begin(); iter != queue.end(); ++iter) {
+			if (running_keys.count(iter->key) == 0) {
+				return iter;
+			}
+		}
+		return queue.end();
+	}
+
+	/// tell once each time the queues grow past SATURATION_DEPTH. call with mutex.
+	void report_saturation()
+	{
+		size_t depth = 0;
+		for (int p = 0; p < JOB_PRIORITY_COUNT; p++) {
+			depth += queues[p].size();
+		}
+		if (depth >= SATURATION_DEPTH && !saturated) {
+			std::cout << "job scheduler saturated:";
+			for (int p = 0; p < JOB_PRIORITY_COUNT; p++) {
+				std::cout << " " << queues[p].size() << " " << PRIORITY_NAMES[p];
+			}
+			std::cout << " queued, " << running_total << " running" << std::endl;
+		}
+		saturated = (depth >= SATURATION_DEPTH);
+	}
+
+	void run(bool interactive, bool background)
+	{
+		if (!interactive) {
+			// per thread on Linux, and inherited by the threads libclang parses on
+			setpriority(PRIO_PROCESS, syscall(SYS_gettid), BACKGROUND_NICE);
+		}
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true) {
+			int priority = -1;
+			wakeup.wait(lock, [this, interactive, background, &priority]() {
+				return stopping || (priority = pick(interactive, background)) >= 0;
+			});
+			if (stopping) {
+				return;
+			}
+			std::deque<Entry>& queue = queues[priority];
+			std::deque<Entry>::iterator iter =
+			    (priority == JOB_INTERACTIVE) ? queue.begin()
+			                                  : find_startable((JobPriority)priority);
+			Entry entry = *iter;
+			queue.erase(iter);
+			bool keyed = (priority != JOB_INTERACTIVE);
+			if (keyed) {
+				running_keys.insert(entry.key);
+			}
+			running[priority]++;
+			running_total++;
+			report_saturation();
+
+			lock.unlock();
+			entry.job();
+			lock.lock();
+
+			if (keyed) {
+				running_keys.erase(entry.key);
+			}
+			running[priority]--;
+			running_total--;
+			if (running_total == 0) {
+				idle.notify_all();
+			}
+			wakeup.notify_all();  // a job held back by this one may start
+		}
+	}
+
+	std::vector<std::thread> workers;
+	std::mutex mutex;  // guards the members below
+	std::condition_variable wakeup;
+	std::condition_variable idle;  // running_total became 0
+	bool stopping = false;
+	int exclusive = 0;  // callers of run_exclusive() waiting or running
+	std::deque<Entry> queues[JOB_PRIORITY_COUNT];
+	size_t running[JOB_PRIORITY_COUNT] = {0, 0, 0};
+	size_t running_total = 0;
+	std::set<std::string> running_keys;  // of the non-interactive jobs
+	bool saturated = false;
+};
+
+JobScheduler::JobScheduler(size_t workers) : pimpl(new JobSchedulerImpl(workers)) {}
+
+JobScheduler::~JobScheduler() { delete pimpl; }
+
+void JobScheduler::post(JobPriority priority, const std::string& key, Job job)
+{
+	pimpl->post(priority, key, job);
+}
+
+void JobScheduler::run_exclusive(const std::function<void()>& f) { pimpl->run_exclusive(f); }
+
+size_t JobScheduler::get_queue_depth(JobPriority priority)
+{
+	return pimpl->get_queue_depth(priority);
+}
+
+size_t JobScheduler::get_running(JobPriority priority) { return pimpl->get_running(priority); }
+
+size_t JobScheduler::default_workers()
+{
+	unsigned cores = std::thread::hardware_concurrency();
+	return std::max<size_t>(1, std::min<size_t>(cores, MAX_WORKERS));
+}
+}
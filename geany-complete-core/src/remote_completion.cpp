@@ -0,0 +1,1061 @@
+/*
+ * remote_completion.cpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <geanycc/remote_completion.hpp>
+#include <geanycc/job_scheduler.hpp>
+#include <geanycc/remote_protocol.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace geanycc
+{
+static const size_t RESTORED_FILES = 4;   // most recently used files parsed by a new helper
+static const int STALE_POLL_MS = 50;      // how often a waiting completion checks for staleness
+static const int RESTART_DELAY_MS = 5000;  // after a helper which never answered
+static const int DAEMON_START_MS = 3000;   // to wait for a new daemon to listen
+static const int DAEMON_IDLE_MS = 5 * 60 * 1000;  // without clients, before a daemon exits
+
+typedef std::chrono::steady_clock Clock;
+
+static int elapsed_ms(Clock::time_point since)
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - since).count();
+}
+
+static bool make_address(const std::string& path, struct sockaddr_un& address)
+{
+	if (path.length() >= sizeof(address.sun_path)) {
+		std::cerr << "socket path too long: " << path << std::endl;
+		return false;
+	}
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, path.c_str());
+	return true;
+}
+
+/// return a socket connected to @a path, or -1
+static int connect_socket(const std::string& path)
+{
+	struct sockaddr_un address;
+	if (!make_address(path, address)) {
+		return -1;
+	}
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd >= 0 && connect(fd, (struct sockaddr*)&address, sizeof(address)) != 0) {
+		close(fd);
+		fd = -1;
+	}
+	return fd;
+}
+
+/**
+    one helper process, or a connection to the shared daemon. requests are written by any
+    thread under write_mutex, answers are read by a thread of its own and handed to the
+    waiting callers by id.
+*/
+struct RemoteHelper
+{
+	int fd = -1;
+	pid_t pid = -1;  // of a private helper, -1 for the daemon
+	std::mutex write_mutex;
+	std::thread reader;
+
+	// guarded by the mutex of the engine
+	bool alive = true;    // until the reader sees the end of the stream
+	bool killed = false;  // on purpose, not a crash
+	bool answered = false;  // it has started up at least
+	std::set<uint32_t> awaited;
+	std::map<uint32_t, std::string> answers;
+
+	~RemoteHelper()
+	{
+		if (fd >= 0) {
+			close(fd);
+		}
+	}
+};
+
+typedef std::shared_ptr<RemoteHelper> RemoteHelperPtr;
+
+class RemoteCodeCompletion::RemoteCodeCompletionImpl
+{
+   public:
+	RemoteCodeCompletionImpl(const std::string& command, const std::string& socket_path)
+	    : command(command), socket_path(socket_path)
+	{
+	}
+
+	~RemoteCodeCompletionImpl()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (helper) {
+			reap(lock);
+		}
+	}
+
+	void set_option(std::vector<std::string>& new_options)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			options = new_options;
+		}
+		MessageWriter payload;
+		write_options(payload, new_options);
+		std::string answer;
+		call(MSG_SET_OPTION, payload, false, answer);  // a new helper gets them on start
+	}
+
+	void set_settings(const CodeCompletionSettings& new_settings)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			settings = new_settings;
+		}
+		MessageWriter payload;
+		write_settings(payload, new_settings);
+		std::string answer;
+		call(MSG_SET_SETTINGS, payload, false, answer);
+	}
+
+	void complete(CodeCompletionResults& results, const char* filename,
+	              const DocumentSnapshot& content, int line, int col, const char* prefix,
+	              int flag)
+	{
+		results.clear();
+		cancelled = false;
+		bool refine = flag & COMPLETE_FLAG_REFINE;
+		bool has_content = !refine;
+		if (refine) {
+			// the helper which has the content of the last completion reuses it
+			std::lock_guard<std::mutex> lock(mutex);
+			has_content = !helper || content_holder.lock() != helper;
+		}
+		std::string name = make_results_name();
+		MessageWriter payload;
+		payload.put_string(name);
+		payload.put_string(filename, strlen(filename));
+		payload.put_string(content.data(), has_content ? content.length() : 0);
+		payload.put_u32(line);
+		payload.put_u32(col);
+		payload.put_string(prefix, strlen(prefix));
+		payload.put_u32(flag);
+
+		std::string answer;
+		RemoteHelperPtr used;
+		bool answered = call(MSG_COMPLETE, payload, true, answer, &used);
+		if (!answered && used) {
+			// the results may have been written before it died
+			shm_unlink(name.c_str());
+		}
+		if (used && has_content) {
+			std::lock_guard<std::mutex> lock(mutex);
+			content_holder = used;
+		}
+		if (used && !refine) {
+			remember(filename, content, answered, used);
+		}
+		if (!answered) {
+			return;
+		}
+		MessageReader reader(answer.data(), answer.length());
+		uint64_t size;
+		if (reader.get_string(name) && reader.get_u64(size) && !name.empty()) {
+			read_shared_results(name, size, results);
+		}
+	}
+
+	void prepare(const char* filename, const DocumentSnapshot& content)
+	{
+		MessageWriter payload;
+		payload.put_string(filename, strlen(filename));
+		payload.put_string(content.data(), content.length());
+		std::string answer;
+		RemoteHelperPtr used;
+		bool answered = call(MSG_PREPARE, payload, true, answer, &used);
+		if (used) {
+			remember(filename, content, answered, used);
+		}
+	}
+
+	void release(const char* filename)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			forget(filename);
+		}
+		MessageWriter payload;
+		payload.put_string(filename, strlen(filename));
+		std::string answer;
+		call(MSG_RELEASE, payload, false, answer);  // a new helper has not parsed it
+	}
+
+	void cancel() { cancelled = true; }
+
+   private:
+	struct RecentFile
+	{
+		std::string filename;
+		std::shared_ptr<const std::string> content;
+	};
+
+	/**
+	    send a request and wait for its answer. with @a start, a helper is started if none
+	    runs. a cancelled completion is given up once it ran for stale_kill_ms; a private
+	    helper is killed, the shared daemon is left to finish it for nobody. return false if
+	    no helper ran, it died or the request was given up. @a used is the helper which was
+	    asked.
+	*/
+	bool call(uint32_t type, const MessageWriter& payload, bool start, std::string& answer,
+	          RemoteHelperPtr* used = NULL)
+	{
+		RemoteHelperPtr target;
+		uint32_t id;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			if (start) {
+				target = ensure_running(lock);
+			} else {
+				while (starting) {
+					cond.wait(lock);  // the new helper must not miss this
+				}
+				if (helper && helper->alive) {
+					target = helper;
+				}
+			}
+			if (!target) {
+				return false;
+			}
+			id = next_id++;
+			target->awaited.insert(id);
+		}
+		if (used) {
+			*used = target;
+		}
+
+		bool sent;
+		{
+			std::lock_guard<std::mutex> lock(target->write_mutex);
+			sent = send_message(target->fd, type, id, payload);
+		}
+		Clock::time_point sent_at = Clock::now();
+
+		std::unique_lock<std::mutex> lock(mutex);
+		bool answered = false;
+		while (sent) {
+			auto iter = target->answers.find(id);
+			if (iter != target->answers.end()) {
+				answer.swap(iter->second);
+				target->answers.erase(iter);
+				answered = true;
+				break;
+			}
+			if (!target->alive) {
+				break;
+			}
+			if (type != MSG_COMPLETE) {
+				cond.wait(lock);
+				continue;
+			}
+			cond.wait_for(lock, std::chrono::milliseconds(STALE_POLL_MS));
+			int elapsed = elapsed_ms(sent_at);
+			if (cancelled && settings.stale_kill_ms > 0 && !target->killed &&
+			    elapsed >= (int)settings.stale_kill_ms) {
+				if (target->pid < 0) {
+					// other editors use the daemon, its answer is dropped when it comes
+					std::cout << "gave up a stale completion after " << elapsed << " ms"
+					          << std::endl;
+					break;
+				}
+				std::cout << "killed completion helper (pid " << target->pid
+				          << ") on a stale completion after " << elapsed << " ms"
+				          << std::endl;
+				target->killed = true;
+				kill(target->pid, SIGKILL);
+			}
+		}
+		target->awaited.erase(id);
+		return answered;
+	}
+
+	/**
+	    a helper which is alive, started if needed. NULL if it cannot start now.
+	    starting one takes a while, so @a lock is released meanwhile and other callers wait
+	    until it is published.
+	*/
+	RemoteHelperPtr ensure_running(std::unique_lock<std::mutex>& lock)
+	{
+		while (true) {
+			if (helper && !helper->alive) {
+				reap(lock);
+			}
+			if (helper) {
+				return helper;  // alive, or started by another thread meanwhile
+			}
+			if (!starting) {
+				break;
+			}
+			cond.wait(lock);
+		}
+		if (Clock::now() < restart_at) {
+			return nullptr;
+		}
+		starting = true;
+		std::vector<std::string> known_options = options;
+		CodeCompletionSettings known_settings = settings;
+		std::deque<RecentFile> known_files = recent;
+		uint32_t first_id = next_id;
+		next_id += 2 + known_files.size();
+		lock.unlock();
+
+		RemoteHelperPtr started = socket_path.empty() ? spawn() : connect_daemon();
+		if (started) {
+			restore(started, first_id, known_options, known_settings, known_files);
+		}
+
+		lock.lock();
+		starting = false;
+		cond.notify_all();
+		if (!started) {
+			restart_at = Clock::now() + std::chrono::milliseconds(RESTART_DELAY_MS);
+			return nullptr;
+		}
+		helper = started;
+		RemoteHelper* raw = helper.get();
+		helper->reader = std::thread([this, raw]() { read_answers(raw); });
+		return helper;
+	}
+
+	RemoteHelperPtr spawn()
+	{
+		int fds[2];
+		if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+			std::cerr << "cannot create a socket for the completion helper: "
+			          << strerror(errno) << std::endl;
+			return nullptr;
+		}
+		// the helper reads requests from its standard input
+		posix_spawn_file_actions_t actions;
+		posix_spawn_file_actions_init(&actions);
+		posix_spawn_file_actions_adddup2(&actions, fds[1], STDIN_FILENO);
+		char* argv[] = {const_cast<char*>(command.c_str()), NULL};
+		pid_t pid;
+		int err = posix_spawn(&pid, command.c_str(), &actions, NULL, argv, environ);
+		posix_spawn_file_actions_destroy(&actions);
+		close(fds[1]);
+		if (err != 0) {
+			close(fds[0]);
+			std::cerr << "cannot start " << command << ": " << strerror(err) << std::endl;
+			return nullptr;
+		}
+		std::cout << "started completion helper " << command << " (pid " << pid << ")"
+		          << std::endl;
+
+		RemoteHelperPtr started(new RemoteHelper());
+		started->fd = fds[0];
+		started->pid = pid;
+		return started;
+	}
+
+	/// connect to the daemon of this user, starting it if none listens
+	RemoteHelperPtr connect_daemon()
+	{
+		int fd = connect_socket(socket_path);
+		if (fd < 0) {
+			// it detaches itself, so that it outlives this editor
+			char* argv[] = {const_cast<char*>(command.c_str()), const_cast<char*>("--daemon"),
+			                const_cast<char*>(socket_path.c_str()), NULL};
+			pid_t pid;
+			int err = posix_spawn(&pid, command.c_str(), NULL, NULL, argv, environ);
+			if (err != 0) {
+				std::cerr << "cannot start " << command << ": " << strerror(err) << std::endl;
+				return nullptr;
+			}
+			waitpid(pid, NULL, 0);
+			for (int waited = 0; fd < 0 && waited < DAEMON_START_MS; waited += STALE_POLL_MS) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(STALE_POLL_MS));
+				fd = connect_socket(socket_path);
+			}
+		}
+		if (fd < 0) {
+			std::cerr << "cannot connect to the completion daemon at " << socket_path
+			          << std::endl;
+			return nullptr;
+		}
+		std::cout << "connected to the completion daemon at " << socket_path << std::endl;
+
+		RemoteHelperPtr connected(new RemoteHelper());
+		connected->fd = fd;
+		return connected;
+	}
+
+	/**
+	    send @a target, which is not published yet, what the previous helper knew.
+	    the answers are not awaited, @a id is the first of the ids reserved for them.
+	*/
+	void restore(const RemoteHelperPtr& target, uint32_t id,
+	             const std::vector<std::string>& known_options,
+	             const CodeCompletionSettings& known_settings,
+	             const std::deque<RecentFile>& known_files)
+	{
+		MessageWriter payload;
+		write_options(payload, known_options);
+		bool sent = send_message(target->fd, MSG_SET_OPTION, id++, payload);
+		payload.clear();
+		write_settings(payload, known_settings);
+		sent = sent && send_message(target->fd, MSG_SET_SETTINGS, id++, payload);
+		for (auto iter = known_files.rbegin(); sent && iter != known_files.rend(); ++iter) {
+			payload.clear();
+			payload.put_string(iter->filename);
+			payload.put_string(*iter->content);
+			sent = send_message(target->fd, MSG_PREPARE, id++, payload);
+		}
+	}
+
+	/// runs on the reader thread of @a target
+	void read_answers(RemoteHelper* target)
+	{
+		MessageHeader header;
+		std::string payload;
+		while (receive_message(target->fd, header, payload)) {
+			std::lock_guard<std::mutex> lock(mutex);
+			target->answered = true;
+			if (target->awaited.count(header.id)) {
+				target->answers[header.id].swap(payload);
+				cond.notify_all();
+			} else if (header.type == MSG_RESULTS) {
+				// of a completion which was given up
+				MessageReader reader(payload.data(), payload.length());
+				std::string name;
+				if (reader.get_string(name) && !name.empty()) {
+					shm_unlink(name.c_str());
+				}
+			}
+		}
+		std::lock_guard<std::mutex> lock(mutex);
+		target->alive = false;  // the last thing it does under the lock, see reap()
+		cond.notify_all();
+	}
+
+	/// wait for the current helper to end, killing it or hanging up if it still runs
+	void reap(std::unique_lock<std::mutex>& lock)
+	{
+		RemoteHelperPtr old;
+		old.swap(helper);
+		bool crashed = !old->killed && !old->alive;
+		if (old->alive) {
+			old->killed = true;
+			if (old->pid > 0) {
+				kill(old->pid, SIGKILL);
+			} else {
+				shutdown(old->fd, SHUT_RDWR);
+			}
+		}
+		if (crashed && !old->answered) {
+			restart_at = Clock::now() + std::chrono::milliseconds(RESTART_DELAY_MS);
+		}
+		// the reader takes the lock until it marks the helper dead
+		lock.unlock();
+		old->reader.join();
+		int status = 0;
+		bool reaped = old->pid > 0 && waitpid(old->pid, &status, 0) == old->pid;
+		lock.lock();
+		if (crashed && old->pid < 0) {
+			std::cerr << "lost the connection to the completion daemon" << std::endl;
+		} else if (crashed && reaped) {
+			if (WIFSIGNALED(status)) {
+				std::cerr << "completion helper (pid " << old->pid << ") was killed by signal "
+				          << WTERMSIG(status) << std::endl;
+			} else {
+				std::cerr << "completion helper (pid " << old->pid << ") exited with "
+				          << WEXITSTATUS(status) << std::endl;
+			}
+		}
+	}
+
+	/**
+	    keep the file @a target has worked on for a restart, unless it may have crashed on it.
+	    that is not parsed again until the editor asks for it.
+	*/
+	void remember(const char* filename, const DocumentSnapshot& content, bool answered,
+	              const RemoteHelperPtr& target)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		forget(filename);
+		if (!answered && !target->killed && !target->alive) {
+			std::cerr << "completion helper died while working on " << filename << std::endl;
+			return;
+		}
+		RecentFile file;
+		file.filename = filename;
+		file.content.reset(new std::string(content.data(), content.length()));
+		recent.push_front(file);
+		if (recent.size() > RESTORED_FILES) {
+			recent.pop_back();
+		}
+	}
+
+	/// call with mutex
+	void forget(const char* filename)
+	{
+		for (auto iter = recent.begin(); iter != recent.end(); ++iter) {
+			if (iter->filename == filename) {
+				recent.erase(iter);
+				return;
+			}
+		}
+	}
+
+	const std::string command;
+	const std::string socket_path;  // of the shared daemon, empty for a private helper
+	std::atomic<bool> cancelled{false};
+
+	std::mutex mutex;  // guards the members below and the state of helpers
+	std::condition_variable cond;  // an answer came, a helper ended or one was started
+	RemoteHelperPtr helper;
+	std::weak_ptr<RemoteHelper> content_holder;  // got the content of the last completion
+	bool starting = false;  // a thread is starting a helper without the lock
+	uint32_t next_id = 1;
+	Clock::time_point restart_at;
+	std::vector<std::string> options;
+	CodeCompletionSettings settings;
+	std::deque<RecentFile> recent;  // most recent first
+};
+
+RemoteCodeCompletion::RemoteCodeCompletion(const std::string& command,
+                                           const std::string& socket_path)
+    : pimpl(new RemoteCodeCompletionImpl(command, socket_path))
+{
+}
+
+RemoteCodeCompletion::~RemoteCodeCompletion() { delete pimpl; }
+
+void RemoteCodeCompletion::set_option(std::vector<std::string>& options)
+{
+	pimpl->set_option(options);
+}
+
+void RemoteCodeCompletion::set_settings(const CodeCompletionSettings& settings)
+{
+	pimpl->set_settings(settings);
+}
+
+void RemoteCodeCompletion::complete(CodeCompletionResults& result, const char* filename,
+                                    const DocumentSnapshot& content, int line, int col,
+                                    const char* prefix, int flag)
+{
+	pimpl->complete(result, filename, content, line, col, prefix, flag);
+}
+
+void RemoteCodeCompletion::prepare(const char* filename, const DocumentSnapshot& content)
+{
+	pimpl->prepare(filename, content);
+}
+
+void RemoteCodeCompletion::release(const char* filename) { pimpl->release(filename); }
+
+void RemoteCodeCompletion::cancel() { pimpl->cancel(); }
+
+namespace
+{
+/// an engine for the clients which sent the same options and settings
+struct EngineSlot
+{
+	std::unique_ptr<CodeCompletionBase> engine;
+	uint32_t serial = 0;
+	// guarded by the mutex of the service
+	std::string key;  // options and settings as they came
+	int users = 0;    // clients
+	std::map<std::string, int> file_refs;  // clients using each file
+	// used by interactive jobs only, which run one at a time
+	uint32_t last_client = 0;  // serial of the client of the last completion
+};
+
+typedef std::shared_ptr<EngineSlot> EngineSlotPtr;
+
+struct ServerConnection
+{
+	int fd = -1;
+	uint32_t serial = 0;  // tells requests of clients with the same ids apart
+	std::mutex write_mutex;
+	// guarded by the mutex of the service
+	std::string options;  // as they came
+	std::string settings;
+	EngineSlotPtr slot;  // for them, chosen on first use
+	std::set<std::string> files;  // used by this client in the engine
+	uint32_t queued_completion = 0;  // its id while it waits
+	DocumentSnapshotPtr content;  // of the last completion, used on the reading thread only
+
+	~ServerConnection()
+	{
+		if (fd >= 0) {
+			close(fd);
+		}
+	}
+};
+
+typedef std::shared_ptr<ServerConnection> ServerConnectionPtr;
+
+/**
+    the other end of RemoteCodeCompletion, for one or more clients.
+    clients which sent the same options and settings share an engine, so that one client does
+    not drop what another has parsed, or get results filtered its way. a client which uses an
+    engine alone changes it in place when its options or settings change. an engine nobody
+    uses is kept until another one is made, for a client which comes back.
+    a file stays parsed while any client of its engine uses it, that is until each client
+    which sent it has released it, moved to another engine or hung up.
+*/
+class CompletionService
+{
+   public:
+	explicit CompletionService(const EngineFactory& create_engine)
+	    : create_engine(create_engine), scheduler(JobScheduler::default_workers())
+	{
+	}
+
+	/// serve @a fd until the client hangs up. clients may be served on threads of their own.
+	void serve(int fd)
+	{
+		ServerConnectionPtr connection(new ServerConnection());
+		connection->fd = fd;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			connection->serial = ++last_serial;
+			connections++;
+		}
+
+		MessageHeader header;
+		std::string payload;
+		while (receive_message(fd, header, payload)) {
+			if (!handle(connection, header, payload)) {
+				std::cerr << "completion helper: unknown message " << header.type << std::endl;
+				break;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		leave_engine(connection);
+		if (--connections == 0) {
+			last_hangup = Clock::now();
+		}
+	}
+
+	/// milliseconds since the last client hung up, -1 while any is connected
+	int get_idle_time()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return connections == 0 ? elapsed_ms(last_hangup) : -1;
+	}
+
+   private:
+	struct CompletionRequest
+	{
+		std::string results_name;
+		std::string filename;
+		DocumentSnapshotPtr content;
+		uint32_t line;
+		uint32_t col;
+		std::string prefix;
+		uint32_t flag;
+	};
+
+	bool handle(const ServerConnectionPtr& connection, const MessageHeader& header,
+	            const std::string& payload)
+	{
+		MessageReader reader(payload.data(), payload.length());
+		switch (header.type) {
+			case MSG_SET_OPTION:
+			case MSG_SET_SETTINGS:
+				if (configure(NULL, header.type, payload)) {
+					reconfigure(connection, header.type, payload);
+				}
+				answer(connection, MSG_DONE, header.id, MessageWriter());
+				break;
+			case MSG_PREPARE:
+				prepare(connection, header.id, reader);
+				break;
+			case MSG_COMPLETE:
+				complete(connection, header.id, reader);
+				break;
+			case MSG_RELEASE: {
+				std::string filename;
+				if (reader.get_string(filename)) {
+					std::lock_guard<std::mutex> lock(mutex);
+					if (connection->files.erase(filename)) {
+						unref_file(connection->slot, filename);
+					}
+				}
+				answer(connection, MSG_DONE, header.id, MessageWriter());
+			} break;
+			default:
+				return false;
+		}
+		return true;
+	}
+
+	/// give @a engine the options or settings of a message of @a type. false if broken.
+	static bool configure(CodeCompletionBase* engine, uint32_t type, const std::string& payload)
+	{
+		MessageReader reader(payload.data(), payload.length());
+		if (type == MSG_SET_OPTION) {
+			std::vector<std::string> options;
+			if (!read_options(reader, options)) {
+				return false;
+			}
+			if (engine) {
+				engine->set_option(options);
+			}
+		} else {
+			CodeCompletionSettings settings;
+			if (!read_settings(reader, settings)) {
+				return false;
+			}
+			if (engine) {
+				engine->set_settings(settings);
+			}
+		}
+		return true;
+	}
+
+	/// keep the engine of the client for its new options or settings, or move it to another
+	void reconfigure(const ServerConnectionPtr& connection, uint32_t type,
+	                 const std::string& payload)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		std::string& applied = type == MSG_SET_OPTION ? connection->options : connection->settings;
+		if (applied == payload) {
+			return;  // new options would drop every parsed file
+		}
+		applied = payload;
+		EngineSlotPtr slot = connection->slot;
+		if (!slot) {
+			return;  // it is chosen on first use
+		}
+		std::string key = get_engine_key(connection);
+		if (slot->users > 1 || engines.count(key)) {
+			leave_engine(connection);
+			return;
+		}
+		engines.erase(slot->key);
+		slot->key = key;
+		engines[key] = slot;
+		lock.unlock();
+		scheduler.run_exclusive([slot, type, &payload]() {
+			configure(slot->engine.get(), type, payload);
+		});
+	}
+
+	/// the engine for the options and settings of the client. call with mutex.
+	const EngineSlotPtr& use_engine(const ServerConnectionPtr& connection)
+	{
+		if (connection->slot) {
+			return connection->slot;
+		}
+		std::string key = get_engine_key(connection);
+		auto iter = engines.find(key);
+		if (iter == engines.end()) {
+			for (auto unused = engines.begin(); unused != engines.end();) {
+				if (unused->second->users == 0) {
+					engines.erase(unused++);  // its jobs keep it until they end
+				} else {
+					++unused;
+				}
+			}
+			EngineSlotPtr slot(new EngineSlot());
+			slot->engine.reset(create_engine());
+			slot->serial = ++last_engine_serial;
+			slot->key = key;
+			if (!connection->options.empty()) {
+				configure(slot->engine.get(), MSG_SET_OPTION, connection->options);
+			}
+			if (!connection->settings.empty()) {
+				configure(slot->engine.get(), MSG_SET_SETTINGS, connection->settings);
+			}
+			iter = engines.insert(std::make_pair(key, slot)).first;
+			std::cout << "completion engines: " << engines.size() << std::endl;
+		}
+		connection->slot = iter->second;
+		connection->slot->users++;
+		return connection->slot;
+	}
+
+	/// the client does not use its engine any more. call with mutex.
+	void leave_engine(const ServerConnectionPtr& connection)
+	{
+		EngineSlotPtr slot;
+		slot.swap(connection->slot);
+		if (!slot) {
+			return;
+		}
+		for (auto iter = connection->files.begin(); iter != connection->files.end(); ++iter) {
+			unref_file(slot, *iter);
+		}
+		connection->files.clear();
+		slot->users--;
+	}
+
+	void prepare(const ServerConnectionPtr& connection, uint32_t id, MessageReader& reader)
+	{
+		std::string filename;
+		const char* text;
+		size_t length;
+		if (!reader.get_string(filename) || !reader.get_string(text, length)) {
+			answer(connection, MSG_DONE, id, MessageWriter());
+			return;
+		}
+		EngineSlotPtr slot = ref_file(connection, filename);
+		DocumentSnapshotPtr content(new DocumentSnapshot(text, length));
+		// keys are unique, the editor has already dropped what was superseded
+		scheduler.post(JOB_WARMUP, get_key(connection, id),
+		               [this, connection, slot, id, filename, content]() {
+			slot->engine->prepare(filename.c_str(), *content);
+			answer(connection, MSG_DONE, id, MessageWriter());
+		});
+	}
+
+	void complete(const ServerConnectionPtr& connection, uint32_t id, MessageReader& reader)
+	{
+		std::shared_ptr<CompletionRequest> request(new CompletionRequest());
+		const char* text;
+		size_t length;
+		bool ok = reader.get_string(request->results_name) &&
+		          reader.get_string(request->filename) && reader.get_string(text, length) &&
+		          reader.get_u32(request->line) && reader.get_u32(request->col) &&
+		          reader.get_string(request->prefix) && reader.get_u32(request->flag);
+		if (ok && length == 0 && (request->flag & COMPLETE_FLAG_REFINE)) {
+			request->content = connection->content;  // the client sent it before
+			ok = request->content != nullptr;
+		} else if (ok) {
+			request->content.reset(new DocumentSnapshot(text, length));
+			connection->content = request->content;
+		}
+		if (!ok) {
+			answer_no_results(connection, id);
+			return;
+		}
+		EngineSlotPtr slot = ref_file(connection, request->filename);
+		uint32_t superseded;
+		{
+			// a newer completion of the client replaces the one which waits
+			std::lock_guard<std::mutex> lock(mutex);
+			superseded = connection->queued_completion;
+			connection->queued_completion = id;
+			scheduler.post(JOB_INTERACTIVE, get_completion_key(connection),
+			               [this, connection, slot, id, request]() {
+				run_completion(connection, slot, id, *request);
+			});
+		}
+		if (superseded) {
+			answer_no_results(connection, superseded);
+		}
+	}
+
+	void run_completion(const ServerConnectionPtr& connection, const EngineSlotPtr& slot,
+	                    uint32_t id, const CompletionRequest& request)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (connection->queued_completion != id) {
+				return;  // started as a newer one came, which answered it
+			}
+			connection->queued_completion = 0;
+		}
+		int flag = request.flag;
+		if (slot->last_client != connection->serial) {
+			// the engine would refine what another client asked for at the same place
+			flag &= ~COMPLETE_FLAG_REFINE;
+			slot->last_client = connection->serial;
+		}
+		// interactive jobs run one at a time, so the results can be reused
+		results.clear();
+		slot->engine->complete(results, request.filename.c_str(), *request.content,
+		                       request.line, request.col, request.prefix.c_str(), flag);
+		std::string name = request.results_name;
+		size_t size = 0;
+		if (!write_shared_results(name, results, size)) {
+			name.clear();
+		}
+		results.clear();  // lets the engine free its raw results
+		MessageWriter payload;
+		payload.put_string(name);
+		payload.put_u64(size);
+		if (!answer(connection, MSG_RESULTS, id, payload) && !name.empty()) {
+			shm_unlink(name.c_str());  // the client has gone
+		}
+	}
+
+	void answer_no_results(const ServerConnectionPtr& connection, uint32_t id)
+	{
+		MessageWriter failed;
+		failed.put_string("");
+		failed.put_u64(0);
+		answer(connection, MSG_RESULTS, id, failed);
+	}
+
+	bool answer(const ServerConnectionPtr& connection, uint32_t type, uint32_t id,
+	            const MessageWriter& payload)
+	{
+		std::lock_guard<std::mutex> lock(connection->write_mutex);
+		return send_message(connection->fd, type, id, payload);
+	}
+
+	/// the engine of the client, which now uses @a filename in it
+	EngineSlotPtr ref_file(const ServerConnectionPtr& connection, const std::string& filename)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		const EngineSlotPtr& slot = use_engine(connection);
+		if (connection->files.insert(filename).second) {
+			slot->file_refs[filename]++;
+		}
+		return slot;
+	}
+
+	/// call with mutex
+	void unref_file(const EngineSlotPtr& slot, const std::string& filename)
+	{
+		auto iter = slot->file_refs.find(filename);
+		if (iter == slot->file_refs.end() || --iter->second > 0) {
+			return;
+		}
+		slot->file_refs.erase(iter);
+		std::ostringstream key;
+		key << "release:" << slot->serial << ":" << filename;
+		scheduler.post(JOB_WARMUP, key.str(), [slot, filename]() {
+			slot->engine->release(filename.c_str());
+		});
+	}
+
+	/// call with mutex
+	static std::string get_engine_key(const ServerConnectionPtr& connection)
+	{
+		std::ostringstream key;
+		key << connection->options.length() << ":" << connection->options
+		    << connection->settings;
+		return key.str();
+	}
+
+	static std::string get_key(const ServerConnectionPtr& connection, uint32_t id)
+	{
+		std::ostringstream key;
+		key << connection->serial << ":" << id;
+		return key.str();
+	}
+
+	/// one completion per client waits at a time
+	static std::string get_completion_key(const ServerConnectionPtr& connection)
+	{
+		std::ostringstream key;
+		key << "complete:" << connection->serial;
+		return key.str();
+	}
+
+	EngineFactory create_engine;
+	CodeCompletionResults results;
+
+	std::mutex mutex;  // guards the members below and what connections and engines share
+	std::map<std::string, EngineSlotPtr> engines;  // by their keys
+	uint32_t last_engine_serial = 0;
+	uint32_t last_serial = 0;
+	int connections = 0;
+	Clock::time_point last_hangup = Clock::now();
+
+	JobScheduler scheduler;  // last, so that jobs end before the rest goes
+};
+}  // namespace
+
+void serve_completion(const EngineFactory& create_engine, int fd)
+{
+	CompletionService service(create_engine);
+	service.serve(fd);
+}
+
+void serve_shared_completion(const EngineFactory& create_engine,
+                             const std::string& socket_path)
+{
+	// one daemon per socket, even if several editors start one at once
+	std::string lock_path = socket_path + ".lock";
+	int lock_fd = open(lock_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+	if (lock_fd < 0 || flock(lock_fd, LOCK_EX | LOCK_NB) != 0) {
+		std::cout << "a completion daemon already serves " << socket_path << std::endl;
+		return;
+	}
+
+	struct sockaddr_un address;
+	if (!make_address(socket_path, address)) {
+		return;
+	}
+	unlink(socket_path.c_str());  // left by a daemon which has died
+	int listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (listen_fd < 0 || bind(listen_fd, (struct sockaddr*)&address, sizeof(address)) != 0 ||
+	    listen(listen_fd, SOMAXCONN) != 0) {
+		std::cerr << "cannot listen at " << socket_path << ": " << strerror(errno)
+		          << std::endl;
+		return;
+	}
+	std::cout << "completion daemon (pid " << getpid() << ") listens at " << socket_path
+	          << std::endl;
+
+	// connection threads are detached, the service stays until the last one ends
+	std::shared_ptr<CompletionService> service(new CompletionService(create_engine));
+	while (true) {
+		struct pollfd pfd;
+		pfd.fd = listen_fd;
+		pfd.events = POLLIN;
+		if (poll(&pfd, 1, 1000) > 0) {
+			int fd = accept4(listen_fd, NULL, NULL, SOCK_CLOEXEC);
+			if (fd >= 0) {
+				std::thread([service, fd]() { service->serve(fd); }).detach();
+			}
+		} else if (service->get_idle_time() >= DAEMON_IDLE_MS) {
+			break;
+		}
+	}
+	std::cout << "completion daemon exits, unused for " << DAEMON_IDLE_MS / 1000 << " s"
+	          << std::endl;
+	// editors coming from now on start a new daemon
+	unlink(socket_path.c_str());
+	close(listen_fd);
+}
+}
@@ -0,0 +1,347 @@
+/*
+ * remote_protocol.cpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <geanycc/remote_protocol.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace geanycc
+{
+static const uint32_t MAX_MESSAGE_LENGTH = 256 * 1024 * 1024;
+// shared with all their texts, enough for the rows the editor shows while the user types
+static const size_t DESCRIBED_ROWS = 256;
+
+bool MessageReader::get_bytes(void* bytes, size_t length)
+{
+	if (rest < length) {
+		rest = 0;
+		return false;
+	}
+	memcpy(bytes, data, length);
+	data += length;
+	rest -= length;
+	return true;
+}
+
+bool MessageReader::get_string(const char*& text, size_t& length)
+{
+	uint32_t n;
+	if (!get_u32(n) || rest < n) {
+		rest = 0;
+		return false;
+	}
+	text = data;
+	length = n;
+	data += n;
+	rest -= n;
+	return true;
+}
+
+bool MessageReader::get_string(std::string& text)
+{
+	const char* p;
+	size_t length;
+	if (!get_string(p, length)) {
+		return false;
+	}
+	text.assign(p, length);
+	return true;
+}
+
+static bool write_all(int fd, const char* data, size_t length)
+{
+	while (length > 0) {
+		ssize_t n = send(fd, data, length, MSG_NOSIGNAL);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		data += n;
+		length -= n;
+	}
+	return true;
+}
+
+static bool read_all(int fd, char* data, size_t length)
+{
+	while (length > 0) {
+		ssize_t n = read(fd, data, length);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return false;
+		}
+		data += n;
+		length -= n;
+	}
+	return true;
+}
+
+bool send_message(int fd, uint32_t type, uint32_t id, const MessageWriter& payload)
+{
+	MessageHeader header;
+	header.type = type;
+	header.id = id;
+	header.length = (uint32_t)payload.data().length();
+	return write_all(fd, (const char*)&header, sizeof(header)) &&
+	       write_all(fd, payload.data().data(), payload.data().length());
+}
+
+bool receive_message(int fd, MessageHeader& header, std::string& payload)
+{
+	if (!read_all(fd, (char*)&header, sizeof(header))) {
+		return false;
+	}
+	if (header.length > MAX_MESSAGE_LENGTH) {
+		std::cerr << "remote completion: broken message of " << header.length << " bytes"
+		          << std::endl;
+		return false;
+	}
+	payload.resize(header.length);
+	return read_all(fd, &payload[0], header.length);
+}
+
+void write_options(MessageWriter& writer, const std::vector<std::string>& options)
+{
+	writer.put_u32((uint32_t)options.size());
+	for (size_t i = 0; i < options.size(); i++) {
+		writer.put_string(options[i]);
+	}
+}
+
+bool read_options(MessageReader& reader, std::vector<std::string>& options)
+{
+	uint32_t count;
+	if (!reader.get_u32(count)) {
+		return false;
+	}
+	options.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		if (!reader.get_string(options[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void write_settings(MessageWriter& writer, const CodeCompletionSettings& settings)
+{
+	writer.put_u64(settings.tu_cache_memory_limit);
+	writer.put_string(settings.preamble_cache_dir);
+	writer.put_u64(settings.preamble_cache_size_limit);
+	writer.put_u64(settings.max_results);
+	writer.put_u32(settings.fuzzy_filter);
+	writer.put_u32(settings.use_compilation_database);
+	writer.put_u64(settings.stale_kill_ms);
+}
+
+bool read_settings(MessageReader& reader, CodeCompletionSettings& settings)
+{
+	uint64_t tu_cache_memory_limit, preamble_cache_size_limit, max_results, stale_kill_ms;
+	uint32_t fuzzy_filter, use_compilation_database;
+	if (!reader.get_u64(tu_cache_memory_limit) ||
+	    !reader.get_string(settings.preamble_cache_dir) ||
+	    !reader.get_u64(preamble_cache_size_limit) || !reader.get_u64(max_results) ||
+	    !reader.get_u32(fuzzy_filter) || !reader.get_u32(use_compilation_database) ||
+	    !reader.get_u64(stale_kill_ms)) {
+		return false;
+	}
+	settings.tu_cache_memory_limit = tu_cache_memory_limit;
+	settings.preamble_cache_size_limit = preamble_cache_size_limit;
+	settings.max_results = max_results;
+	settings.fuzzy_filter = fuzzy_filter;
+	settings.use_compilation_database = use_compilation_database;
+	settings.stale_kill_ms = stale_kill_ms;
+	return true;
+}
+
+std::string make_results_name()
+{
+	static std::atomic<uint32_t> serial(0);
+	std::ostringstream name;
+	name << "/geanycc-" << getpid() << "-" << ++serial;
+	return name.str();
+}
+
+/*
+    layout of shared results:
+      u32 rows, u64 total, string prefix,
+      per row: u32 type | availability << 8, string typed text
+    a string is a u32 length and the bytes without a terminator.
+*/
+
+namespace
+{
+class SharedWriter
+{
+   public:
+	explicit SharedWriter(char* data) : data(data) {}
+	void put_u32(uint32_t value) { put_bytes(&value, sizeof(value)); }
+	void put_u64(uint64_t value) { put_bytes(&value, sizeof(value)); }
+	void put_string(const char* text, size_t length)
+	{
+		put_u32((uint32_t)length);
+		put_bytes(text, length);
+	}
+
+   private:
+	void put_bytes(const void* bytes, size_t length)
+	{
+		memcpy(data, bytes, length);
+		data += length;
+	}
+
+	char* data;
+};
+
+/// rows which came without their texts, so they are not asked from the server on display
+class TypedTextDetails : public CompletionDetails
+{
+   public:
+	void describe(CodeCompletionResults& results, size_t row, uint32_t source)
+	{
+		std::string typed = results.typed_text(row);  // the arena may move
+		results.set_text(row, CodeCompletionResults::SIGNATURE, typed);
+	}
+};
+}  // namespace
+
+bool write_shared_results(const std::string& name, CodeCompletionResults& results,
+                          size_t& size)
+{
+	// the engine's raw results do not leave this process
+	size_t described = std::min(results.size(), DESCRIBED_ROWS);
+	for (size_t row = 0; row < described; row++) {
+		results.describe(row);
+	}
+	size = sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint32_t) +
+	       results.prefix().length();
+	for (size_t row = 0; row < results.size(); row++) {
+		int fields = row < described ? CodeCompletionResults::TEXT_FIELD_COUNT : 1;
+		size += sizeof(uint32_t);
+		for (int field = CodeCompletionResults::TYPED_TEXT; field < fields; field++) {
+			size += sizeof(uint32_t) +
+			        results.text_length(row, (CodeCompletionResults::TextField)field);
+		}
+	}
+	int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (fd < 0) {
+		std::cerr << "remote completion: cannot create " << name << ": " << strerror(errno)
+		          << std::endl;
+		return false;
+	}
+	void* memory = MAP_FAILED;
+	if (ftruncate(fd, size) == 0) {
+		memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	}
+	close(fd);
+	if (memory == MAP_FAILED) {
+		std::cerr << "remote completion: cannot map " << name << std::endl;
+		shm_unlink(name.c_str());
+		return false;
+	}
+
+	SharedWriter writer((char*)memory);
+	writer.put_u32((uint32_t)results.size());
+	writer.put_u32((uint32_t)described);
+	writer.put_u64(results.total());
+	writer.put_string(results.prefix().c_str(), results.prefix().length());
+	for (size_t row = 0; row < results.size(); row++) {
+		int fields = row < described ? CodeCompletionResults::TEXT_FIELD_COUNT : 1;
+		writer.put_u32((uint32_t)results.type(row) | (uint32_t)results.availability(row) << 8);
+		for (int field = CodeCompletionResults::TYPED_TEXT; field < fields; field++) {
+			CodeCompletionResults::TextField f = (CodeCompletionResults::TextField)field;
+			writer.put_string(results.text(row, f), results.text_length(row, f));
+		}
+	}
+	munmap(memory, size);
+	return true;
+}
+
+bool read_shared_results(const std::string& name, size_t size, CodeCompletionResults& results)
+{
+	results.clear();
+	int fd = shm_open(name.c_str(), O_RDONLY, 0);
+	if (fd < 0) {
+		std::cerr << "remote completion: cannot open " << name << std::endl;
+		return false;
+	}
+	shm_unlink(name.c_str());  // gone once unmapped
+	void* memory = size ? mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+	close(fd);
+	if (memory == MAP_FAILED) {
+		std::cerr << "remote completion: cannot map " << name << std::endl;
+		return false;
+	}
+
+	MessageReader reader((const char*)memory, size);
+	uint32_t rows, described;
+	uint64_t total;
+	std::string prefix;
+	bool ok = reader.get_u32(rows) && reader.get_u32(described) && reader.get_u64(total) &&
+	          reader.get_string(prefix);
+	if (ok) {
+		results.reserve(rows, size);
+		results.set_total(total);
+		results.set_prefix(prefix);
+	}
+	for (uint32_t i = 0; ok && i < rows; i++) {
+		if (i == described) {
+			results.set_details(std::make_shared<TypedTextDetails>());
+		}
+		uint32_t kind;
+		if (!reader.get_u32(kind)) {
+			ok = false;
+			break;
+		}
+		size_t row = results.add((CompleteResultType)(kind & 0xff),
+		                         (CompleteResultAvailability)(kind >> 8), i);
+		int fields = i < described ? CodeCompletionResults::TEXT_FIELD_COUNT : 1;
+		for (int field = CodeCompletionResults::TYPED_TEXT; ok && field < fields; field++) {
+			const char* text;
+			size_t length;
+			ok = reader.get_string(text, length);
+			if (ok) {
+				results.set_text(row, (CodeCompletionResults::TextField)field, text, length);
+			}
+		}
+	}
+	munmap(memory, size);
+	if (!ok) {
+		std::cerr << "remote completion: broken results in " << name << std::endl;
+		results.clear();
+	}
+	return ok;
+}
+}
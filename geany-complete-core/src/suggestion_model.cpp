@@ -0,0 +1,201 @@
+/*
+ * suggestion_model.cpp - a core code of Geany completion plugins
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <geanycc/suggestion_model.hpp>
+
+namespace geanycc
+{
+struct SuggestionModel
+{
+	GObject parent;
+	gint stamp;  // changes with the rows, so that old iterators are detected
+	const CodeCompletionResults* results;
+	const std::vector<uint32_t>* rows;
+	const std::vector<GdkPixbuf*>* icons;
+};
+
+struct SuggestionModelClass
+{
+	GObjectClass parent_class;
+};
+
+static void suggestion_model_tree_model_init(GtkTreeModelIface* iface);
+
+G_DEFINE_TYPE_WITH_CODE(SuggestionModel, suggestion_model, G_TYPE_OBJECT,
+                        G_IMPLEMENT_INTERFACE(GTK_TYPE_TREE_MODEL,
+                                              suggestion_model_tree_model_init))
+
+static void suggestion_model_class_init(SuggestionModelClass* klass) {}
+
+static void suggestion_model_init(SuggestionModel* self)
+{
+	self->stamp = 1;
+	self->results = NULL;
+	self->rows = NULL;
+	self->icons = NULL;
+}
+
+static inline SuggestionModel* get_self(GtkTreeModel* model)
+{
+	return G_TYPE_CHECK_INSTANCE_CAST(model, suggestion_model_get_type(), SuggestionModel);
+}
+
+static inline gint row_count(SuggestionModel* self)
+{
+	return self->rows ? (gint)self->rows->size() : 0;
+}
+
+static inline void set_iter(SuggestionModel* self, GtkTreeIter* iter, gint n)
+{
+	iter->stamp = self->stamp;
+	iter->user_data = GUINT_TO_POINTER(n);
+}
+
+static GtkTreeModelFlags get_flags(GtkTreeModel* model) { return GTK_TREE_MODEL_LIST_ONLY; }
+
+static gint get_n_columns(GtkTreeModel* model) { return SUGGESTION_MODEL_N_COLUMNS; }
+
+static GType get_column_type(GtkTreeModel* model, gint column)
+{
+	switch (column) {
+		case SUGGESTION_MODEL_TYPEDTEXT:
+			return G_TYPE_STRING;
+		case SUGGESTION_MODEL_ROW:
+			return G_TYPE_UINT;
+		default:
+			return GDK_TYPE_PIXBUF;
+	}
+}
+
+static gboolean get_iter(GtkTreeModel* model, GtkTreeIter* iter, GtkTreePath* path)
+{
+	SuggestionModel* self = get_self(model);
+	if (gtk_tree_path_get_depth(path) != 1) {
+		return FALSE;
+	}
+	gint n = gtk_tree_path_get_indices(path)[0];
+	if (n < 0 || n >= row_count(self)) {
+		return FALSE;
+	}
+	set_iter(self, iter, n);
+	return TRUE;
+}
+
+static GtkTreePath* get_path(GtkTreeModel* model, GtkTreeIter* iter)
+{
+	return gtk_tree_path_new_from_indices(GPOINTER_TO_UINT(iter->user_data), -1);
+}
+
+static void get_value(GtkTreeModel* model, GtkTreeIter* iter, gint column, GValue* value)
+{
+	SuggestionModel* self = get_self(model);
+	uint32_t row = (*self->rows)[GPOINTER_TO_UINT(iter->user_data)];
+	g_value_init(value, get_column_type(model, column));
+	switch (column) {
+		case SUGGESTION_MODEL_TYPEDTEXT:
+			g_value_set_string(value, self->results->typed_text(row));
+			break;
+		case SUGGESTION_MODEL_ROW:
+			g_value_set_uint(value, row);
+			break;
+		default:
+			g_value_set_object(value, (*self->icons)[self->results->type(row)]);
+			break;
+	}
+}
+
+static gboolean iter_next(GtkTreeModel* model, GtkTreeIter* iter)
+{
+	SuggestionModel* self = get_self(model);
+	gint n = GPOINTER_TO_UINT(iter->user_data) + 1;
+	if (n >= row_count(self)) {
+		iter->stamp = 0;
+		return FALSE;
+	}
+	set_iter(self, iter, n);
+	return TRUE;
+}
+
+static gboolean iter_nth_child(GtkTreeModel* model, GtkTreeIter* iter, GtkTreeIter* parent,
+                               gint n)
+{
+	SuggestionModel* self = get_self(model);
+	if (parent || n < 0 || n >= row_count(self)) {
+		return FALSE;
+	}
+	set_iter(self, iter, n);
+	return TRUE;
+}
+
+static gboolean iter_children(GtkTreeModel* model, GtkTreeIter* iter, GtkTreeIter* parent)
+{
+	return iter_nth_child(model, iter, parent, 0);
+}
+
+static gboolean iter_has_child(GtkTreeModel* model, GtkTreeIter* iter) { return FALSE; }
+
+static gint iter_n_children(GtkTreeModel* model, GtkTreeIter* iter)
+{
+	return iter ? 0 : row_count(get_self(model));
+}
+
+static gboolean iter_parent(GtkTreeModel* model, GtkTreeIter* iter, GtkTreeIter* child)
+{
+	return FALSE;
+}
+
+static void suggestion_model_tree_model_init(GtkTreeModelIface* iface)
+{
+	iface->get_flags = get_flags;
+	iface->get_n_columns = get_n_columns;
+	iface->get_column_type = get_column_type;
+	iface->get_iter = get_iter;
+	iface->get_path = get_path;
+	iface->get_value = get_value;
+	iface->iter_next = iter_next;
+	iface->iter_children = iter_children;
+	iface->iter_has_child = iter_has_child;
+	iface->iter_n_children = iter_n_children;
+	iface->iter_nth_child = iter_nth_child;
+	iface->iter_parent = iter_parent;
+}
+
+GtkTreeModel* suggestion_model_new(const std::vector<GdkPixbuf*>* icons)
+{
+	SuggestionModel* self = (SuggestionModel*)g_object_new(suggestion_model_get_type(), NULL);
+	self->icons = icons;
+	return GTK_TREE_MODEL(self);
+}
+
+void suggestion_model_set_rows(GtkTreeModel* model, const CodeCompletionResults* results,
+                               const std::vector<uint32_t>* rows)
+{
+	SuggestionModel* self = get_self(model);
+	self->results = results;
+	self->rows = rows;
+	self->stamp++;
+}
+
+void suggestion_model_set_results(GtkTreeModel* model, const CodeCompletionResults* results)
+{
+	get_self(model)->results = results;
+}
+}
@@ -20,22 +20,16 @@
  */
 
 #include <geanycc/suggestion_window.hpp>
+#include <geanycc/suggestion_model.hpp>
 
 #include <string.h>
+#include <algorithm>
 #include <gdk/gdkkeysyms.h>
 
 namespace geanycc
 {
 namespace detail
 {
-static void get_note_height(GtkWidget* widget, int* height)
-{
-	GtkAllocation allocation;
-	gtk_widget_get_allocation(widget, &allocation);
-	if (*height < allocation.height) {
-		*height = allocation.height;
-	}
-}
 static gboolean close_request(GtkWidget* widget, GdkEvent* event, SuggestionWindow* self)
 {
 	self->close();
@@ -43,7 +37,8 @@ static gboolean close_request(GtkWidget* widget, GdkEvent* event, SuggestionWind
 }
 }
 
-enum { MODEL_TYPEDTEXT_INDEX = 0, MODEL_LABEL_INDEX = 1, MODEL_TYPE_INDEX = 2 };
+// rows whose signatures are built up front to estimate the width of the window
+static const size_t WIDTH_SAMPLE_ROWS = 32;
 
 void SuggestionWindow::move_cursor(bool down)
 {
@@ -75,7 +70,7 @@ void SuggestionWindow::select_suggestion()
 	GtkTreeSelection* selection = gtk_tree_view_get_selection(GTK_TREE_VIEW(tree_view));
 	if (gtk_tree_selection_get_selected(selection, &model, &iter)) {
 		gchar* typedtext;
-		gtk_tree_model_get(model, &iter, MODEL_TYPEDTEXT_INDEX, &typedtext, -1);
+		gtk_tree_model_get(model, &iter, SUGGESTION_MODEL_TYPEDTEXT, &typedtext, -1);
 
 		int dist = strlen(typedtext) - filtered_str.length();
 
@@ -171,45 +166,211 @@ gboolean SuggestionWindow::signal_mouse_scroll(GtkWidget* widget, GdkEventScroll
 	}
 }
 
+/**
+    in fuzzy mode, pack the typed texts for the matcher. otherwise sort the rows by
+    typed text, so that the rows starting with the filter are one range.
+ */
+void SuggestionWindow::build_filter_index()
+{
+	if (fuzzy_filter) {
+		matcher.clear();
+		matcher.reserve(results->size(), results->size() * 16);
+		for (size_t i = 0; i < results->size(); i++) {
+			matcher.add(results->typed_text(i),
+			            results->text_length(i, CodeCompletionResults::TYPED_TEXT));
+		}
+		return;
+	}
+
+	sorted_rows.resize(results->size());
+	for (size_t i = 0; i < sorted_rows.size(); i++) {
+		sorted_rows[i] = i;
+	}
+	const CodeCompletionResults& rows = *results;
+	std::sort(sorted_rows.begin(), sorted_rows.end(), [&rows](uint32_t a, uint32_t b) {
+		return strcmp(rows.typed_text(a), rows.typed_text(b)) < 0;
+	});
+	FilterRange all = {0, 0, sorted_rows.size()};
+	filter_ranges.assign(1, all);
+}
+
 void SuggestionWindow::do_filtering()
 {
 	if (!this->is_showing()) {
 		return;
 	}
+	if (fuzzy_filter) {
+		do_fuzzy_filtering();
+		return;
+	}
 
-	GtkTreeIter iter;
-
-	if (gtk_tree_model_get_iter_first(GTK_TREE_MODEL(model), &iter)) {
-		do {
-			gchar* typedtext;
-			gtk_tree_model_get(GTK_TREE_MODEL(model), &iter, MODEL_TYPEDTEXT_INDEX, &typedtext, -1);
+	// ranges of a longer filter are stale after backspace
+	while (filter_ranges.size() > 1 && filter_ranges.back().length > filtered_str.length()) {
+		filter_ranges.pop_back();
+	}
+	if (filter_ranges.back().length < filtered_str.length()) {
+		// narrow the range of the shorter filter
+		const CodeCompletionResults& rows = *results;
+		const char* prefix = filtered_str.c_str();
+		size_t length = filtered_str.length();
+		std::vector<uint32_t>::iterator first = sorted_rows.begin() + filter_ranges.back().begin;
+		std::vector<uint32_t>::iterator last = sorted_rows.begin() + filter_ranges.back().end;
+		first = std::lower_bound(first, last, prefix,
+		                         [&rows, length](uint32_t row, const char* prefix) {
+			return strncmp(rows.typed_text(row), prefix, length) < 0;
+		});
+		last = std::upper_bound(first, last, prefix,
+		                        [&rows, length](const char* prefix, uint32_t row) {
+			return strncmp(prefix, rows.typed_text(row), length) < 0;
+		});
+		FilterRange range = {length, (size_t)(first - sorted_rows.begin()),
+		                     (size_t)(last - sorted_rows.begin())};
+		filter_ranges.push_back(range);
+	}
 
-			gboolean endFlag = FALSE;
-			if (strstr(typedtext, filtered_str.c_str()) == typedtext) {
-				GtkTreePath* path = gtk_tree_model_get_path(GTK_TREE_MODEL(model), &iter);
-				gtk_tree_view_scroll_to_cell(GTK_TREE_VIEW(tree_view), path, NULL, TRUE, 0.0, 0.0);
-				gtk_tree_view_set_cursor_on_cell(GTK_TREE_VIEW(tree_view), path, NULL, NULL, FALSE);
-				gtk_tree_path_free(path);
+	const FilterRange& range = filter_ranges.back();
+	if (range.begin == range.end) { /* not found */
+		this->close();
+		return;
+	}
+	// the first matching row in the list
+	uint32_t row = *std::min_element(sorted_rows.begin() + range.begin,
+	                                 sorted_rows.begin() + range.end);
+	size_t position = row;
+	if (position >= shown_rows.size() || shown_rows[position] != row) {
+		position = std::find(shown_rows.begin(), shown_rows.end(), row) - shown_rows.begin();
+		if (position == shown_rows.size()) {
+			return;
+		}
+	}
+	GtkTreePath* path = gtk_tree_path_new_from_indices(position, -1);
+	gtk_tree_view_scroll_to_cell(GTK_TREE_VIEW(tree_view), path, NULL, TRUE, 0.0, 0.0);
+	gtk_tree_view_set_cursor_on_cell(GTK_TREE_VIEW(tree_view), path, NULL, NULL, FALSE);
+	gtk_tree_path_free(path);
+}
 
-				endFlag = TRUE;
-			}
-			g_free(typedtext);
-			if (endFlag) {
-				return;
-			}
-		} while (gtk_tree_model_iter_next(GTK_TREE_MODEL(model), &iter));
+void SuggestionWindow::set_fuzzy_filter(bool fuzzy)
+{
+	if (fuzzy == fuzzy_filter) {
+		return;
+	}
+	fuzzy_filter = fuzzy;
+	if (!this->is_showing()) {
+		return;
+	}
+	// list every row again, as the plain filter does
+	build_filter_index();
+	next_rows.resize(results->size());
+	for (size_t i = 0; i < next_rows.size(); i++) {
+		next_rows[i] = i;
+	}
+	patch_rows(*results);
+	do_filtering();
+}
 
-		/* not found */
-		this->close();
-	} else { /* empty suggestion */
+/**
+    list only the matching rows, best first. an empty filter lists all rows.
+ */
+void SuggestionWindow::do_fuzzy_filtering()
+{
+	matches.clear();
+	if (filtered_str.empty()) {
+		for (size_t i = 0; i < results->size(); i++) {
+			FuzzyMatcher::Match m = {0, (uint32_t)i};
+			matches.push_back(m);
+		}
+	} else {
+		matcher.match(filtered_str, matches);
+	}
+	if (matches.empty()) { /* not found */
 		this->close();
+		return;
+	}
+
+	next_rows.resize(matches.size());
+	for (size_t i = 0; i < matches.size(); i++) {
+		next_rows[i] = matches[i].index;
+	}
+	patch_rows(*results);
+
+	GtkTreePath* path = gtk_tree_path_new_first();
+	gtk_tree_view_scroll_to_cell(GTK_TREE_VIEW(tree_view), path, NULL, TRUE, 0.0, 0.0);
+	gtk_tree_view_set_cursor_on_cell(GTK_TREE_VIEW(tree_view), path, NULL, NULL, FALSE);
+	gtk_tree_path_free(path);
+}
+
+static inline bool same_row(const CodeCompletionResults& a, uint32_t a_row,
+                            const CodeCompletionResults& b, uint32_t b_row)
+{
+	return a.type(a_row) == b.type(b_row) && strcmp(a.typed_text(a_row), b.typed_text(b_row)) == 0;
+}
+
+/**
+    make next_rows of results the shown rows, which are rows of @a old now.
+    the same rows at both ends are kept and only the rows between are removed and inserted,
+    so that the view keeps its scroll position and what it has measured.
+ */
+void SuggestionWindow::patch_rows(const CodeCompletionResults& old)
+{
+	const size_t old_n = shown_rows.size();
+	const size_t new_n = next_rows.size();
+	size_t head = 0;
+	while (head < old_n && head < new_n &&
+	       same_row(old, shown_rows[head], *results, next_rows[head])) {
+		head++;
+	}
+	size_t tail = 0;
+	while (tail < old_n - head && tail < new_n - head &&
+	       same_row(old, shown_rows[old_n - 1 - tail], *results, next_rows[new_n - 1 - tail])) {
+		tail++;
+	}
+
+	const size_t removed = old_n - head - tail;
+	const size_t inserted = new_n - head - tail;
+	if (removed + inserted > (old_n + new_n) / 2) {
+		// mostly new, one reset is cheaper than a signal per row
+		gtk_tree_view_set_model(GTK_TREE_VIEW(tree_view), NULL);
+		shown_rows.swap(next_rows);
+		suggestion_model_set_rows(model, results.get(), &shown_rows);
+		gtk_tree_view_set_model(GTK_TREE_VIEW(tree_view), model);
+		return;
+	}
+
+	// the view may read any row during a signal, so no row may refer to old from here
+	for (size_t i = 0; i < head; i++) {
+		shown_rows[i] = next_rows[i];
+	}
+	for (size_t i = 0; i < tail; i++) {
+		shown_rows[old_n - 1 - i] = next_rows[new_n - 1 - i];
+	}
+	// any row of results does for those about to be removed. next_rows is not empty here,
+	// removing every row takes the reset above
+	for (size_t i = head; i < old_n - tail; i++) {
+		shown_rows[i] = next_rows[0];
+	}
+	suggestion_model_set_results(model, results.get());
+
+	for (size_t i = head + removed; i-- > head;) {
+		shown_rows.erase(shown_rows.begin() + i);
+		GtkTreePath* path = gtk_tree_path_new_from_indices(i, -1);
+		gtk_tree_model_row_deleted(model, path);
+		gtk_tree_path_free(path);
+	}
+	for (size_t i = head; i < head + inserted; i++) {
+		shown_rows.insert(shown_rows.begin() + i, next_rows[i]);
+		GtkTreePath* path = gtk_tree_path_new_from_indices(i, -1);
+		GtkTreeIter iter;
+		gtk_tree_model_get_iter(model, &iter, path);
+		gtk_tree_model_row_inserted(model, path, &iter);
+		gtk_tree_path_free(path);
 	}
 }
 
 void SuggestionWindow::filter_backspace()
 {
 	if (this->is_showing()) {
-		if (filtered_str.empty()) {
+		// rows which do not start with the prefix of the request were not returned
+		if (filtered_str.length() <= results->prefix().length()) {
 			this->close();
 		} else {
 			filtered_str.erase(filtered_str.length() - 1);
@@ -258,98 +419,31 @@ void SuggestionWindow::arrange_window()
 	*/
 	int show_x, show_y;
 
-	GtkWidget* main_window = geany_data->main_widgets->window;
-	GtkWidget* notebook_widget = geany_data->main_widgets->notebook;
 	ScintillaObject* sci = document_get_current()->editor->sci;
 
+	// points from Scintilla are relative to its window, margins and scrolling included
 	gint x_origin, y_origin;
-	GdkWindow* gdk_window = gtk_widget_get_window(GTK_WIDGET(main_window));
+	GdkWindow* gdk_window = gtk_widget_get_window(GTK_WIDGET(sci));
 	gdk_window_get_origin(gdk_window, &x_origin, &y_origin);
 
-	GtkAllocation rect_mainwindow;
-	gtk_widget_get_allocation(main_window, &rect_mainwindow);
-	CHECK_ARRANGE("mainwin %d %d %d %d", rect_mainwindow.x, rect_mainwindow.y,
-	              rect_mainwindow.width, rect_mainwindow.height);
+	GtkAllocation rect_sci;
+	gtk_widget_get_allocation(GTK_WIDGET(sci), &rect_sci);
 
-	GtkAllocation rect_notebook;
-	gtk_widget_get_allocation(notebook_widget, &rect_notebook);
-	CHECK_ARRANGE("notebook %d %d %d %d", rect_notebook.x, rect_notebook.y, rect_notebook.width,
-	              rect_notebook.height);
-
-	int note_height = 0;
-	gtk_container_foreach(GTK_CONTAINER(notebook_widget), (GtkCallback)detail::get_note_height,
-	                      &note_height);
-	int note_tab_height = rect_notebook.height - note_height;
-
-	int margin_width = 0;
-	for (int i = 0; i < 5; i++) {
-		margin_width += scintilla_send_message(sci, SCI_GETMARGINWIDTHN, i, 0);
-	}
-	int x_scroll_offset = scintilla_send_message(sci, SCI_GETXOFFSET, 0, 0);
+	int pos = sci_get_current_position(sci);
+	int caret_x = scintilla_send_message(sci, SCI_POINTXFROMPOSITION, 0, pos);
+	int caret_y = scintilla_send_message(sci, SCI_POINTYFROMPOSITION, 0, pos);
 
 	// Scintilla says "Currently all lines are the same height."
 	int text_height = scintilla_send_message(sci, SCI_TEXTHEIGHT, 0, 0);
 
-	// real line (including line wrapped)
-	int top_line = scintilla_send_message(sci, SCI_GETFIRSTVISIBLELINE, 0, 0);
-
-	// calc caret-position from top of a note
-	int cur_line = sci_get_current_line(sci);  // file line (no wrap)
-	int real_visible_line = 0;
-	for (int i = 0; i < cur_line; i++) {
-		if (sci_get_line_is_visible(sci, i)) {
-			real_visible_line += scintilla_send_message(sci, SCI_WRAPCOUNT, i, 0);
-		}
-	}
-	int diff_line = real_visible_line - top_line;
+	if (0 <= caret_y && caret_y + text_height <= rect_sci.height) {
+		CHECK_ARRANGE("x_origin=%d caret_x=%d y_origin=%d caret_y=%d txt_h=%d", x_origin,
+		              caret_x, y_origin, caret_y, text_height);
 
-	// calc caret-position from left of a note
-	int pos = sci_get_current_position(sci);
-	int line = sci_get_current_line(sci);
-	int ls_pos = sci_get_position_from_line(sci, line);
-	int text_width = 0;
-	if (ls_pos < pos) {
-		int space_pix = scintilla_send_message(sci, SCI_TEXTWIDTH, STYLE_DEFAULT, (sptr_t) " ");
-		int tab_pix = space_pix * sci_get_tab_width(sci);
-		// g_print("space_pix %d tab_pix %d", space_pix, tab_pix);
-		gchar* line_str = sci_get_contents_range(sci, ls_pos, pos);
-		if (g_utf8_validate(line_str, -1, NULL)) {
-			gchar* letter = NULL;
-			gchar* next = line_str;
-			while (next[0]) {
-				letter = next;
-				next = g_utf8_next_char(next);
-				if (letter[0] == '\t') {
-					int mod = text_width % tab_pix;
-					text_width += (mod == 0 ? tab_pix : tab_pix - mod);
-				} else {
-					// check each character (for no monospace)
-					int styleID = sci_get_style_at(sci, ls_pos + (letter - line_str));
-					gchar tmp = next[0];  // for making a letter from a string
-					next[0] = '\0';
-					int tw = scintilla_send_message(sci, SCI_TEXTWIDTH, styleID, (sptr_t)letter);
-					next[0] = tmp;  // restore from NULL
-					text_width += tw;
-				}
-			}
-		}
-		g_free(line_str);
-	}
-
-	int screen_lines = scintilla_send_message(sci, SCI_LINESONSCREEN, 0, 0);
-
-	if (0 <= diff_line && diff_line < screen_lines) {
-		int total_text_height = diff_line * text_height;
-
-		CHECK_ARRANGE("x_origin=%d notebook.x=%d margin_w=%d txt_width=%d (x_scroll_offset=%d)",
-		              x_origin, rect_notebook.x, margin_width, text_width, x_scroll_offset);
-		CHECK_ARRANGE("y_origin=%d notebook.y=%d note_tab_height=%d total_txt_h=%d txt_h%d",
-		              y_origin, rect_notebook.y, note_tab_height, total_text_height, text_height);
-
-		show_x = x_origin + rect_notebook.x + margin_width + text_width - x_scroll_offset;
-		show_y = y_origin + rect_notebook.y + note_tab_height + total_text_height + text_height + 1;
+		show_x = x_origin + caret_x;
+		show_y = y_origin + caret_y + text_height + 1;
 	} else {  // out of screen
-		g_print("out of screen %d %d", diff_line, screen_lines);
+		g_print("out of screen %d %d", caret_y, rect_sci.height);
 		show_x = 0;
 		show_y = 0;
 	}
@@ -379,42 +473,130 @@ void SuggestionWindow::arrange_window()
 	gtk_window_move(GTK_WINDOW(window), show_x, show_y);
 }
 
-void SuggestionWindow::setup_showing(const CodeCompletionResults& results)
+/**
+    signatures are built here, so only for rows which are drawn.
+ */
+void SuggestionWindow::render_label(GtkTreeViewColumn* column, GtkCellRenderer* cell,
+                                    GtkTreeModel* model, GtkTreeIter* iter, gpointer self)
+{
+	CodeCompletionResults& results = *static_cast<SuggestionWindow*>(self)->results;
+	guint row;
+	gtk_tree_model_get(model, iter, SUGGESTION_MODEL_ROW, &row, -1);
+	results.describe(row);
+	bool provisional = static_cast<SuggestionWindow*>(self)->provisional;
+	g_object_set(G_OBJECT(cell), "text", results.signature(row), "style",
+	             provisional ? PANGO_STYLE_ITALIC : PANGO_STYLE_NORMAL, NULL);
+}
+
+void SuggestionWindow::setup_showing(const CodeCompletionResultsPtr& new_results)
 {
 	CHECK_ARRANGE("start suggest show %d", max_char_in_row);
-	int max_signature_length = 0;
 	gtk_tree_view_set_model(GTK_TREE_VIEW(tree_view), NULL);
-	gtk_list_store_clear(model);
-
-	GtkTreeIter iter;
-	for (size_t i = 0; i < results.size(); i++) {
-		const char* typedtext = results[i].typed_text.c_str();
-		std::string labelstdstr = results[i].signature;
-		if (labelstdstr.length() > max_char_in_row) {
-			labelstdstr = labelstdstr.substr(0, max_char_in_row);
+	results = new_results;
+
+	// a signature starts with the typed text, the first rows tell how much follows it
+	size_t max_signature_length = 0;
+	for (size_t i = 0; i < results->size(); i++) {
+		size_t length = results->text_length(i, CodeCompletionResults::TYPED_TEXT);
+		if (i < WIDTH_SAMPLE_ROWS) {
+			results->describe(i);
+			length = results->text_length(i, CodeCompletionResults::SIGNATURE);
 		}
-		gtk_list_store_append(model, &iter);
-		gtk_list_store_set(model, &iter, MODEL_TYPEDTEXT_INDEX, typedtext, MODEL_LABEL_INDEX,
-		                   labelstdstr.c_str(), MODEL_TYPE_INDEX, icon_pixbufs[results[i].type],
-		                   -1);
+		max_signature_length = std::max(max_signature_length, length);
+	}
+	max_signature_length = std::min<size_t>(max_signature_length, max_char_in_row);
 
-		if (max_signature_length < labelstdstr.length()) {
-			max_signature_length = labelstdstr.length();
-		}
+	shown_rows.resize(results->size());
+	for (size_t i = 0; i < shown_rows.size(); i++) {
+		shown_rows[i] = i;
 	}
+	suggestion_model_set_rows(model, results.get(), &shown_rows);
 
-	gtk_tree_view_set_model(GTK_TREE_VIEW(tree_view), GTK_TREE_MODEL(model));
+	build_filter_index();
+
+	gtk_tree_view_set_model(GTK_TREE_VIEW(tree_view), model);
 	GtkTreeViewColumn* col = gtk_tree_view_get_column(GTK_TREE_VIEW(tree_view), 1);
 	gtk_tree_view_column_set_fixed_width(col, max_signature_length * character_width + 10);
 
 	CHECK_ARRANGE("max_signature_length %d char width %d", max_signature_length, character_width);
 }
 
-void SuggestionWindow::show(const CodeCompletionResults& results, const char* initial_filter)
+/**
+    replace the shown results while the window is up. the window stays where it is and
+    rows which did not change stay in the view, so the list does not flicker or jump.
+ */
+void SuggestionWindow::update_showing(const CodeCompletionResultsPtr& new_results,
+                                      const char* initial_filter)
 {
-	if (!results.empty()) {
-		if (this->is_showing()) {  // close and show
-			this->close();
+	GtkTreeSelection* selection = gtk_tree_view_get_selection(GTK_TREE_VIEW(tree_view));
+	GtkTreeIter iter;
+	std::string selected_text;
+	int selected_type = -1;
+	if (gtk_tree_selection_get_selected(selection, NULL, &iter)) {
+		guint row;
+		gtk_tree_model_get(model, &iter, SUGGESTION_MODEL_ROW, &row, -1);
+		selected_text = results->typed_text(row);
+		selected_type = results->type(row);
+	}
+
+	CodeCompletionResultsPtr old = results;  // still shown until patched
+	results = new_results;
+
+	filtered_str = initial_filter ? initial_filter : "";
+	build_filter_index();
+	next_rows.clear();
+	if (fuzzy_filter && !filtered_str.empty()) {
+		matcher.match(filtered_str, matches);
+		for (size_t i = 0; i < matches.size(); i++) {
+			next_rows.push_back(matches[i].index);
+		}
+	} else {
+		for (size_t i = 0; i < results->size(); i++) {
+			next_rows.push_back(i);
+		}
+	}
+	if (next_rows.empty()) {
+		gtk_tree_view_set_model(GTK_TREE_VIEW(tree_view), NULL);
+		shown_rows.clear();
+		this->close();
+		return;
+	}
+	patch_rows(*old);
+
+	// keep the selection on the same candidate if it is still there
+	if (selected_type >= 0) {
+		for (size_t i = 0; i < shown_rows.size(); i++) {
+			uint32_t row = shown_rows[i];
+			if (results->type(row) == selected_type &&
+			    selected_text == results->typed_text(row)) {
+				GtkTreePath* path = gtk_tree_path_new_from_indices(i, -1);
+				gtk_tree_view_set_cursor_on_cell(GTK_TREE_VIEW(tree_view), path, NULL, NULL,
+				                                 FALSE);
+				gtk_tree_path_free(path);
+				return;
+			}
+		}
+	}
+	if (filtered_str.empty()) {
+		GtkTreePath* path = gtk_tree_path_new_first();
+		gtk_tree_view_set_cursor_on_cell(GTK_TREE_VIEW(tree_view), path, NULL, NULL, FALSE);
+		gtk_tree_path_free(path);
+	} else {
+		do_filtering();
+	}
+}
+
+void SuggestionWindow::show(const CodeCompletionResultsPtr& results, const char* initial_filter,
+                            bool provisional)
+{
+	if (results && !results->empty()) {
+		if (this->provisional != provisional) {
+			this->provisional = provisional;
+			gtk_widget_queue_draw(tree_view);  // kept rows change their style too
+		}
+		if (this->is_showing()) {
+			update_showing(results, initial_filter);
+			return;
 		}
 		setup_showing(results);
 		arrange_window();
@@ -435,7 +617,7 @@ void SuggestionWindow::show(const CodeCompletionResults& results, const char* in
 
 #include "data/sw_icon_resources.hpp"
 
-SuggestionWindow::SuggestionWindow() : showing_flag(false)
+SuggestionWindow::SuggestionWindow() : results(new CodeCompletionResults()), showing_flag(false)
 {
 	window = gtk_window_new(GTK_WINDOW_POPUP);
 	gtk_container_set_border_width(GTK_CONTAINER(window), 1);
@@ -443,9 +625,9 @@ SuggestionWindow::SuggestionWindow() : showing_flag(false)
 	gtk_window_set_decorated(GTK_WINDOW(window), FALSE);
 	gtk_widget_set_size_request(window, 150, 150);
 
-	model = gtk_list_store_new(3, G_TYPE_STRING, G_TYPE_STRING, GDK_TYPE_PIXBUF);
+	model = suggestion_model_new(&icon_pixbufs);
 
-	tree_view = gtk_tree_view_new_with_model(GTK_TREE_MODEL(model));
+	tree_view = gtk_tree_view_new_with_model(model);
 	gtk_tree_view_set_headers_visible(GTK_TREE_VIEW(tree_view), FALSE);
 
 	/* create icon pixbuf
@@ -467,15 +649,22 @@ SuggestionWindow::SuggestionWindow() : showing_flag(false)
 
 	GtkCellRenderer* pixbuf_renderer = gtk_cell_renderer_pixbuf_new();
 	GtkTreeViewColumn* i_column = gtk_tree_view_column_new_with_attributes(
-	    "icon", pixbuf_renderer, "pixbuf", MODEL_TYPE_INDEX, NULL);
+	    "icon", pixbuf_renderer, "pixbuf", SUGGESTION_MODEL_TYPE, NULL);
+	gtk_tree_view_column_set_sizing(i_column, GTK_TREE_VIEW_COLUMN_FIXED);
+	gtk_tree_view_column_set_fixed_width(i_column, gdk_pixbuf_get_width(icon_pixbufs[0]) + 8);
 	gtk_tree_view_append_column(GTK_TREE_VIEW(tree_view), i_column);
 
 	GtkCellRenderer* text_renderer = gtk_cell_renderer_text_new();
-	GtkTreeViewColumn* t_column = gtk_tree_view_column_new_with_attributes(
-	    "label", text_renderer, "text", MODEL_LABEL_INDEX, NULL);
-	g_object_set(G_OBJECT(text_renderer), "family", "Monospace", NULL);
+	GtkTreeViewColumn* t_column = gtk_tree_view_column_new();
+	gtk_tree_view_column_set_title(t_column, "label");
+	gtk_tree_view_column_pack_start(t_column, text_renderer, TRUE);
+	gtk_tree_view_column_set_cell_data_func(t_column, text_renderer, render_label, this, NULL);
+	g_object_set(G_OBJECT(text_renderer), "family", "Monospace", "ellipsize",
+	             PANGO_ELLIPSIZE_END, NULL);
 	gtk_tree_view_column_set_sizing(t_column, GTK_TREE_VIEW_COLUMN_FIXED);
 	gtk_tree_view_append_column(GTK_TREE_VIEW(tree_view), t_column);
+	// rows are not measured one by one, so labels of rows out of sight are never built
+	gtk_tree_view_set_fixed_height_mode(GTK_TREE_VIEW(tree_view), TRUE);
 
 	// get character width for determinate treeview width
 	PangoFontDescription* pango_fontdesc;
@@ -512,6 +701,7 @@ SuggestionWindow::SuggestionWindow() : showing_flag(false)
 SuggestionWindow::~SuggestionWindow()
 {
 	gtk_widget_destroy(window);
+	g_object_unref(model);
 	g_signal_handler_disconnect(G_OBJECT(geany_data->main_widgets->window), sig_handler_id[0]);
 	g_signal_handler_disconnect(G_OBJECT(geany_data->main_widgets->window), sig_handler_id[1]);
 }
@@ -0,0 +1,185 @@
+/*
+ * compilation_database.cpp - a Geany plugin to provide code completion using clang
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include "compilation_database.hpp"
+#include "preamble_cache.hpp"  // hash_bytes
+
+#include <iostream>
+
+#include <sys/stat.h>
+
+using namespace geanycc;
+
+static const char* DATABASE_FILE = "/compile_commands.json";
+
+/// where the database of @a dir is, "/" being the root
+static std::string get_database_path(const std::string& dir)
+{
+	return (dir == "/" ? std::string() : dir) + DATABASE_FILE;
+}
+
+/// -MD and the like, which make the compiler write a dependency file. @a takes_value is set
+/// for -MF, -MT and -MQ given apart from their value.
+static bool is_dependency_option(const std::string& arg, bool& takes_value)
+{
+	takes_value = arg == "-MF" || arg == "-MT" || arg == "-MQ";
+	return arg.compare(0, 2, "-M") == 0 || arg.compare(0, 6, "-Wp,-M") == 0;
+}
+
+static std::string get_string(CXString str)
+{
+	const char* cstr = clang_getCString(str);
+	std::string ret(cstr ? cstr : "");
+	clang_disposeString(str);
+	return ret;
+}
+
+void CompilationDatabase::clear()
+{
+	for (auto it = databases.begin(); it != databases.end(); ++it) {
+		clang_CompilationDatabase_dispose(it->second.db);
+	}
+	databases.clear();
+	source_dirs.clear();
+}
+
+std::shared_ptr<const CompilationDatabase::Arguments> CompilationDatabase::find(
+    const std::string& filename)
+{
+	size_t slash = filename.rfind('/');
+	if (slash == std::string::npos) {
+		return nullptr;
+	}
+	Database* database = find_database(filename.substr(0, slash));
+	if (!database) {
+		return nullptr;
+	}
+	auto it = database->files.find(filename);
+	if (it != database->files.end()) {
+		return it->second;  // NULL is cached too, for files the database does not know
+	}
+	std::shared_ptr<const Arguments> args = resolve(database, filename);
+	database->files[filename] = args;
+	return args;
+}
+
+CompilationDatabase::Database* CompilationDatabase::find_database(const std::string& source_dir)
+{
+	std::string db_dir;
+	auto it = source_dirs.find(source_dir);
+	if (it != source_dirs.end()) {
+		db_dir = it->second;
+	} else {
+		struct stat st;
+		// walk up to the root, which an absolute source_dir reaches as ""
+		std::string dir = source_dir;
+		for (;;) {
+			std::string candidate = dir.empty() ? "/" : dir;
+			if (stat(get_database_path(candidate).c_str(), &st) == 0) {
+				db_dir = candidate;
+				break;
+			}
+			if (stat((dir + "/build" + DATABASE_FILE).c_str(), &st) == 0) {
+				db_dir = dir + "/build";
+				break;
+			}
+			size_t slash = dir.rfind('/');
+			if (dir.empty() || slash == std::string::npos) {
+				break;
+			}
+			dir.erase(slash);
+		}
+		source_dirs[source_dir] = db_dir;
+	}
+	if (db_dir.empty()) {
+		return NULL;
+	}
+
+	struct stat st;
+	bool exists = (stat(get_database_path(db_dir).c_str(), &st) == 0);
+	auto dit = databases.find(db_dir);
+	if (dit != databases.end()) {
+		if (exists && dit->second.mtime == st.st_mtime) {
+			return &dit->second;
+		}
+		clang_CompilationDatabase_dispose(dit->second.db);
+		databases.erase(dit);
+	}
+	if (!exists) {
+		return NULL;
+	}
+	CXCompilationDatabase_Error err;
+	CXCompilationDatabase db = clang_CompilationDatabase_fromDirectory(db_dir.c_str(), &err);
+	if (err != CXCompilationDatabase_NoError || !db) {
+		std::cerr << "failed to load " << get_database_path(db_dir) << std::endl;
+		return NULL;
+	}
+	std::cout << "loaded " << get_database_path(db_dir) << std::endl;
+	Database& database = databases[db_dir];
+	database.db = db;
+	database.mtime = st.st_mtime;
+	return &database;
+}
+
+std::shared_ptr<const CompilationDatabase::Arguments> CompilationDatabase::resolve(
+    Database* database, const std::string& filename)
+{
+	CXCompileCommands commands =
+	    clang_CompilationDatabase_getCompileCommands(database->db, filename.c_str());
+	if (!commands) {
+		return nullptr;
+	}
+	if (clang_CompileCommands_getSize(commands) == 0) {
+		clang_CompileCommands_dispose(commands);
+		return nullptr;
+	}
+
+	CXCompileCommand command = clang_CompileCommands_getCommand(commands, 0);
+	std::string command_file = get_string(clang_CompileCommand_getFilename(command));
+	std::shared_ptr<Arguments> result(new Arguments());
+	std::vector<std::string>& args = result->args;
+	// relative include paths are relative to the build directory
+	args.push_back("-working-directory=" +
+	               get_string(clang_CompileCommand_getDirectory(command)));
+
+	// skip the compiler itself, the source file and output options
+	unsigned n = clang_CompileCommand_getNumArgs(command);
+	for (unsigned i = 1; i < n; i++) {
+		std::string arg = get_string(clang_CompileCommand_getArg(command, i));
+		bool takes_value;
+		if (arg == "-o") {
+			i++;
+		} else if (is_dependency_option(arg, takes_value)) {
+			if (takes_value) {
+				i++;
+			}
+		} else if (arg != "-c" && arg != command_file && arg != filename) {
+			args.push_back(arg);
+		}
+	}
+	clang_CompileCommands_dispose(commands);
+
+	result->hash = hash_bytes("", 0);
+	for (size_t i = 0; i < args.size(); i++) {
+		result->hash = hash_bytes(args[i].c_str(), args[i].length() + 1, result->hash);
+	}
+	return result;
+}
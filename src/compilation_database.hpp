@@ -0,0 +1,74 @@
+/*
+ * compilation_database.hpp - a Geany plugin to provide code completion using clang
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+#include <clang-c/CXCompilationDatabase.h>
+
+namespace geanycc
+{
+/**
+    resolves per-file compiler arguments from the nearest compile_commands.json.
+
+    databases are found by walking up from the source directory (also looking into build/),
+    and are reloaded when the json file is modified. resolved arguments are cached by path,
+    so a lookup costs one hash probe and one stat() of the database.
+*/
+class CompilationDatabase
+{
+   public:
+	struct Arguments
+	{
+		std::vector<std::string> args;
+		size_t hash;  // identifies the argument list
+	};
+
+	CompilationDatabase() {}
+	~CompilationDatabase() { clear(); }
+
+	void clear();
+
+	/// return arguments of @a filename, or NULL if no database knows the file
+	std::shared_ptr<const Arguments> find(const std::string& filename);
+
+   private:
+	CompilationDatabase(const CompilationDatabase&);
+	void operator=(const CompilationDatabase&);
+
+	struct Database
+	{
+		CXCompilationDatabase db;
+		time_t mtime;
+		std::unordered_map<std::string, std::shared_ptr<const Arguments> > files;
+	};
+
+	Database* find_database(const std::string& source_dir);
+	Database* load_database(const std::string& db_dir);
+	std::shared_ptr<const Arguments> resolve(Database* database, const std::string& filename);
+
+	std::unordered_map<std::string, std::string> source_dirs;  // source dir -> database dir
+	std::unordered_map<std::string, Database> databases;       // database dir -> database
+};
+}
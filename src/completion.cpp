@@ -20,14 +20,21 @@
  */
 
 #include "completion.hpp"
+#include "preamble_cache.hpp"
+#include "compilation_database.hpp"
+
+#include <geanycc/fuzzy_match.hpp>
 
 #include <iostream>
 #include <string>
 #include <vector>
 #include <memory>
 #include <map>
+#include <list>
 #include <cstring>
-#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <mutex>
 
 #include <clang-c/Index.h>
 
@@ -69,9 +76,17 @@ static CompleteResultType getCursorType(const CXCompletionResult& result)
 	}
 }
 
+/**
+    builds texts of a completion result. one parser is reused for many results,
+    so its buffers are allocated only once.
+*/
 struct CompletionStringParser
 {
-	CompleteResultRow* r;
+	CompleteResultAvailability availability;
+	std::string typed_text;
+	std::string return_type;
+	std::string arguments;
+	std::string signature;
 	std::string text;
 	int enter_optional_count;
 	int enter_arguments;
@@ -81,19 +96,19 @@ struct CompletionStringParser
 		CXAvailabilityKind kind = clang_getCompletionAvailability(comp_str);
 		switch (kind) {
 			case CXAvailability_Available:
-				r->availability = COMPLETE_RESULT_AVAIL_AVAIL;
+				availability = COMPLETE_RESULT_AVAIL_AVAIL;
 				break;
 			case CXAvailability_Deprecated:
-				r->availability = COMPLETE_RESULT_AVAIL_DEPRECATED;
+				availability = COMPLETE_RESULT_AVAIL_DEPRECATED;
 				break;
 			case CXAvailability_NotAvailable:
-				r->availability = COMPLETE_RESULT_AVAIL_NOTAVAIL;
+				availability = COMPLETE_RESULT_AVAIL_NOTAVAIL;
 				break;
 			case CXAvailability_NotAccessible:
-				r->availability = COMPLETE_RESULT_AVAIL_NOTACCESS;
+				availability = COMPLETE_RESULT_AVAIL_NOTACCESS;
 				break;
 			default:
-				r->availability = COMPLETE_RESULT_AVAIL_NOTAVAIL;
+				availability = COMPLETE_RESULT_AVAIL_NOTAVAIL;
 				break;
 		}
 	}
@@ -111,9 +126,9 @@ struct CompletionStringParser
 		CXString text = clang_getCompletionChunkText(comp_str, chunk_idx);
 		const char* cstr = clang_getCString(text);
 		if (cstr) {
-			r->signature += cstr;
+			signature += cstr;
 			if (enter_arguments) {
-				r->arguments += cstr;
+				arguments += cstr;
 			}
 		}
 		clang_disposeString(text);
@@ -122,9 +137,9 @@ struct CompletionStringParser
 	template <typename T>
 	void look(T val)
 	{
-		r->signature += val;
+		signature += val;
 		if (enter_arguments) {
-			r->arguments += val;
+			arguments += val;
 		}
 	}
 
@@ -146,10 +161,10 @@ struct CompletionStringParser
 					}
 					break;
 				case CXCompletionChunk_TypedText:
-					append(r->typed_text, comp_str, i);
+					append(typed_text, comp_str, i);
 					break;
 				case CXCompletionChunk_ResultType:
-					append(r->return_type, comp_str, i);
+					append(return_type, comp_str, i);
 					break;
 				case CXCompletionChunk_Placeholder:
 					look(comp_str, i);
@@ -211,37 +226,249 @@ struct CompletionStringParser
 		}
 	}
 
-	void parse(CompleteResultRow* r, const CXCompletionResult& result)
+	/// only the availability and typed text, which the list needs for every row
+	void parse_typed_text(const CXCompletionResult& result)
+	{
+		CXCompletionString comp_str = result.CompletionString;
+		setAveailability(comp_str);
+		typed_text.clear();
+		unsigned N = clang_getNumCompletionChunks(comp_str);
+		for (unsigned i = 0; i < N; i++) {
+			if (clang_getCompletionChunkKind(comp_str, i) == CXCompletionChunk_TypedText) {
+				append(typed_text, comp_str, i);
+				break;
+			}
+		}
+	}
+
+	void parse(const CXCompletionResult& result)
 	{
-		this->r = r;
-		r->type = getCursorType(result);
 		CXCompletionString comp_str = result.CompletionString;
 		setAveailability(comp_str);
 		enter_optional_count = 0;
 		enter_arguments = 0;
-		text = "";
+		typed_text.clear();
+		return_type.clear();
+		arguments.clear();
+		signature.clear();
+		text.clear();
 		do_parse(comp_str);
-		r->signature.insert(0, r->typed_text);
-		if (r->return_type != "") {
-			r->signature += " -> ";
-			r->signature += r->return_type;
+		signature.insert(0, typed_text);
+		if (return_type != "") {
+			signature += " -> ";
+			signature += return_type;
 		}
 		if (text != "") {
-			r->signature += " {";
-			r->signature += text;
-			r->signature += "}";
+			signature += " {";
+			signature += text;
+			signature += "}";
+		}
+	}
+
+	/// append a row of the parsed typed text to @a results
+	void store(CodeCompletionResults& results, CompleteResultType type, uint32_t source)
+	{
+		size_t row = results.add(type, availability, source);
+		results.set_text(row, CodeCompletionResults::TYPED_TEXT, typed_text);
+	}
+
+	/// set the other parsed texts of @a row
+	void store_details(CodeCompletionResults& results, size_t row)
+	{
+		results.set_text(row, CodeCompletionResults::RETURN_TYPE, return_type);
+		results.set_text(row, CodeCompletionResults::ARGUMENTS, arguments);
+		results.set_text(row, CodeCompletionResults::SIGNATURE, signature);
+	}
+};
+
+/// a result passing the filter, ordered best first
+struct Candidate
+{
+	int score;  // of the fuzzy match
+	unsigned priority;
+	unsigned index;
+
+	bool operator<(const Candidate& other) const
+	{
+		if (score != other.score) {
+			return score > other.score;
 		}
+		return priority != other.priority ? priority < other.priority : index < other.index;
 	}
 };
 
-class CppCodeCompletion::CodeCompletionImpl
+static long elapsed_msec(std::chrono::steady_clock::time_point from)
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+	           std::chrono::steady_clock::now() - from).count();
+}
+
+/// sum of the memory libclang reports for a translation unit (bytes)
+static size_t get_memory_usage(CXTranslationUnit tu)
+{
+	size_t total = 0;
+	CXTUResourceUsage usage = clang_getCXTUResourceUsage(tu);
+	for (unsigned i = 0; i < usage.numEntries; i++) {
+		total += usage.entries[i].amount;
+	}
+	clang_disposeCXTUResourceUsage(usage);
+	return total;
+}
+
+/**
+    an index, disposed once the last unit parsed with it is gone. libclang requires units
+    to be disposed before their index, and results built lazily keep units after the cache
+    has dropped them.
+*/
+class ClangIndex
 {
    public:
+	/* (excludeDeclarationsFromPCH, displayDiagnostics) */
+	ClangIndex() : index(clang_createIndex(0, 0)) {}
+	~ClangIndex()
+	{
+		if (index) {
+			clang_disposeIndex(index);
+		}
+	}
+
+	/// NULL if it could not be created
+	CXIndex get() const { return index; }
+
+   private:
+	ClangIndex(const ClangIndex&);
+	void operator=(const ClangIndex&);
+
 	CXIndex index;
-	std::map<std::string, CXTranslationUnit> tu_cache;
-	std::vector<std::string> commandline_args;
+};
+
+typedef std::shared_ptr<ClangIndex> ClangIndexPtr;
+
+/**
+    a cached translation unit. it is locked while it is parsed or completed in, so that
+    different files are worked on in parallel. once evicted, the unit is disposed right away
+    if nobody works in it, else with the last reference. completion details keep the entry
+    only to dispose their results.
+*/
+struct TranslationUnitEntry
+{
+	ClangIndexPtr index;  // which tu is parsed with, it outlives tu
+	std::mutex mutex;  // guards the members but index, lru_pos and memory_usage
+	CXTranslationUnit tu = NULL;
+	std::string content;  // which tu was last (re)parsed with, its preamble blanked
+	size_t args_hash = 0;        // compiler arguments which tu was parsed with
+	size_t preamble_length = 0;  // of the buffer, included from a precompiled header instead
+	size_t preamble_hash = 0;
+	size_t memory_usage = 0;     // guarded by cache_mutex, as accounted in tu_cache_memory
+	std::list<std::string>::iterator lru_pos;  // guarded by cache_mutex
 
-	CodeCompletionImpl() : index(NULL)
+	std::mutex garbage_mutex;
+	std::vector<CXCodeCompleteResults*> garbage;  // completion results nobody uses
+
+	~TranslationUnitEntry()
+	{
+		dispose_garbage();
+		if (tu) {
+			clang_disposeTranslationUnit(tu);
+		}
+	}
+
+	/// call with mutex. completion results keep what their strings refer to, so they
+	/// outlive the unit.
+	void dispose_unit()
+	{
+		dispose_garbage();
+		if (tu) {
+			clang_disposeTranslationUnit(tu);
+			tu = NULL;
+		}
+		std::string().swap(content);
+	}
+
+	/// from any thread
+	void add_garbage(CXCodeCompleteResults* results)
+	{
+		std::lock_guard<std::mutex> lock(garbage_mutex);
+		garbage.push_back(results);
+	}
+
+	/// call with mutex, or when nobody else uses the entry
+	void dispose_garbage()
+	{
+		std::vector<CXCodeCompleteResults*> disposed;
+		{
+			std::lock_guard<std::mutex> lock(garbage_mutex);
+			disposed.swap(garbage);
+		}
+		for (size_t i = 0; i < disposed.size(); i++) {
+			clang_disposeCodeCompleteResults(disposed[i]);
+		}
+	}
+};
+
+typedef std::shared_ptr<TranslationUnitEntry> TranslationUnitEntryPtr;
+
+/**
+    keeps the clang results of a request, so that signatures are built only for rows
+    which are displayed. completion strings belong to the results and later parses of the
+    unit do not touch them. the results share reference counts with the unit, so they are
+    disposed by whoever works in the unit next, see TranslationUnitEntry::dispose_garbage().
+*/
+class ClangCompletionDetails : public CompletionDetails
+{
+   public:
+	ClangCompletionDetails(CXCodeCompleteResults* results, const TranslationUnitEntryPtr& entry)
+	    : results(results), entry(entry)
+	{
+	}
+	~ClangCompletionDetails() { entry->add_garbage(results); }
+
+	void describe(CodeCompletionResults& rows, size_t row, uint32_t source)
+	{
+		parser.parse(results->Results[source]);
+		parser.store_details(rows, row);
+	}
+
+	const CXCodeCompleteResults* get() const { return results; }
+
+   private:
+	ClangCompletionDetails(const ClangCompletionDetails&);
+	void operator=(const ClangCompletionDetails&);
+
+	CXCodeCompleteResults* results;
+	TranslationUnitEntryPtr entry;  // kept, so that the results can be disposed with it
+	CompletionStringParser parser;
+};
+
+
+class CppCodeCompletion::CodeCompletionImpl
+{
+   public:
+	// only holds options, units parsed with it may be used from any thread. units which
+	// are still used keep theirs when it is replaced
+	ClangIndexPtr index;
+
+	std::mutex cache_mutex;  // guards the cache, the databases and the accounting below
+	std::map<std::string, TranslationUnitEntryPtr> tu_cache;
+	std::list<std::string> tu_lru;  // front is the most recently used
+	size_t tu_cache_memory = 0;
+	size_t tu_cache_memory_limit = 0;
+	std::shared_ptr<CompilationDatabase::Arguments> commandline_args;  // global options
+	CompilationDatabase compilation_database;
+	bool use_compilation_database = false;
+
+	PreambleCache preamble_cache;  // entries are per file, which its unit's lock serializes
+	size_t max_results = 0;
+	bool fuzzy_filter = false;
+
+	// results of the last request, reused while only its prefix is extended
+	std::shared_ptr<ClangCompletionDetails> last_details;
+	std::string last_filename;
+	int last_line = 0;
+	int last_col = 0;
+	std::vector<Candidate> candidates;  // reused
+
+	CodeCompletionImpl() : commandline_args(new CompilationDatabase::Arguments())
 	{
 		CXString version = clang_getClangVersion();
 		std::cout << clang_getCString(version) << std::endl;
@@ -259,9 +486,10 @@ class CppCodeCompletion::CodeCompletionImpl
 	void create_index()
 	{
 		clear_index();
-		index = clang_createIndex(0, 0); /* (excludeDeclarationsFromPCH, displayDiagnostics) */
-		if (!index) {
+		index.reset(new ClangIndex());
+		if (!index->get()) {
 			std::cerr << "an unexpected error @ clang_createIndex" << std::endl;
+			index.reset();
 		}
 	}
 
@@ -269,101 +497,477 @@ class CppCodeCompletion::CodeCompletionImpl
 	{
 		if (index) {
 			clear_translation_unit_cache();
-			clang_disposeIndex(index);
-			index = NULL;
+			index.reset();  // disposed with the last unit parsed with it
+		}
+	}
+
+	/// the cache entry of @a filename, added empty if there is none. call with cache_mutex.
+	TranslationUnitEntryPtr find_entry(const char* filename)
+	{
+		std::map<std::string, TranslationUnitEntryPtr>::iterator it = tu_cache.find(filename);
+		if (it != tu_cache.end()) {
+			tu_lru.splice(tu_lru.begin(), tu_lru, it->second->lru_pos);
+			return it->second;
+		}
+		TranslationUnitEntryPtr entry(new TranslationUnitEntry());
+		entry->index = index;
+		entry->lru_pos = tu_lru.insert(tu_lru.begin(), filename);
+		tu_cache[filename] = entry;
+		return entry;
+	}
+
+	/**
+	    blank out the preamble which the unit of @a entry includes from a precompiled header,
+	    keeping the lines where they are.
+	*/
+	static void cut_preamble(TranslationUnitEntry* entry)
+	{
+		for (size_t i = 0; i < entry->preamble_length; i++) {
+			if (entry->content[i] != '\n') {
+				entry->content[i] = ' ';
+			}
+		}
+	}
+
+	/**
+	    make the content of @a entry that of @a unsaved, whose preamble is the same. only the
+	    part which changed is copied. return false if nothing changed.
+	*/
+	static bool patch_content(TranslationUnitEntry* entry, const CXUnsavedFile& unsaved)
+	{
+		std::string& content = entry->content;
+		const char* text = unsaved.Contents;
+		size_t length = unsaved.Length;
+		size_t common = std::min(content.length(), length);
+		size_t head = std::min(entry->preamble_length, common);
+		head = std::mismatch(content.begin() + head, content.begin() + common, text + head)
+		           .first - content.begin();
+		if (head == common && content.length() == length) {
+			return false;
+		}
+		size_t tail = 0;
+		while (tail < common - head &&
+		       content[content.length() - 1 - tail] == text[length - 1 - tail]) {
+			tail++;
 		}
+		content.replace(head, content.length() - tail - head, text + head, length - tail - head);
+		return true;
 	}
 
-	CXTranslationUnit get_translation_unit(const char* filename, const char* content)
+	/// the content of @a entry as clang is given it
+	static CXUnsavedFile get_unsaved(const TranslationUnitEntry* entry, const char* filename)
 	{
+		CXUnsavedFile unsaved;
+		unsaved.Filename = filename;
+		unsaved.Contents = entry->content.data();
+		unsaved.Length = entry->content.length();
+		return unsaved;
+	}
+
+	static bool has_same_preamble(const TranslationUnitEntry* entry, const CXUnsavedFile& unsaved)
+	{
+		return unsaved.Length >= entry->preamble_length &&
+		       hash_bytes(unsaved.Contents, entry->preamble_length) == entry->preamble_hash;
+	}
+
+	/**
+	    parse a new unit into @a entry, with the headers precompiled on disk if possible.
+	    then the unit is given its content without the preamble, see cut_preamble().
+	*/
+	void parse_entry(const char* filename, TranslationUnitEntry* entry,
+	                 const CompilationDatabase::Arguments& arguments,
+	                 const CXUnsavedFile& unsaved)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		size_t preamble_length = 0;
+		std::string pch = preamble_cache.get(entry->index->get(), filename, arguments.args,
+		                                     unsaved.Contents, unsaved.Length, preamble_length);
 		CXTranslationUnit tu = NULL;
-		if (tu_cache.find(filename) != tu_cache.end()) {
-			tu = tu_cache[filename];
-		} else {  // not found -> create
-			std::unique_ptr<const char*[]> argv(new const char*[commandline_args.size()]);
-			for (size_t i = 0; i < commandline_args.size(); i++) {
-				argv[i] = commandline_args[i].c_str();
+		entry->preamble_length = 0;
+		entry->content.assign(unsaved.Contents, unsaved.Length);
+		if (!pch.empty()) {
+			std::vector<std::string> args(arguments.args);
+			args.push_back("-include-pch");
+			args.push_back(pch);
+			entry->preamble_length = preamble_length;
+			entry->preamble_hash = hash_bytes(unsaved.Contents, preamble_length);
+			cut_preamble(entry);
+			tu = parse_translation_unit(entry->index->get(), filename, args,
+			                            get_unsaved(entry, filename));
+			if (!tu || has_fatal_error(tu)) {
+				entry->preamble_length = 0;
+				entry->content.assign(unsaved.Contents, unsaved.Length);
+				std::cerr << "could not use the cached preamble of " << filename << std::endl;
+				preamble_cache.invalidate(pch);
+				if (tu) {
+					clang_disposeTranslationUnit(tu);
+					tu = NULL;
+				}
 			}
-			CXUnsavedFile f[1];
-			f[0].Filename = filename;
-			f[0].Contents = content;
-			f[0].Length = strlen(content);
-			tu = clang_parseTranslationUnit(index, filename, argv.get(), commandline_args.size(),
-			                                f, 1, clang_defaultEditingTranslationUnitOptions());
-			if (tu) {
-				tu_cache.insert(std::pair<std::string, CXTranslationUnit>(filename, tu));
+		}
+		if (!tu) {
+			tu = parse_translation_unit(entry->index->get(), filename, arguments.args,
+			                            get_unsaved(entry, filename));
+		}
+		if (!tu) {
+			return;
+		}
+		std::cout << "parsed " << filename << " in " << elapsed_msec(start) << " ms" << std::endl;
+		entry->tu = tu;
+		entry->args_hash = arguments.hash;
+	}
+
+	/// per-file arguments from compile_commands.json, or the global options
+	std::shared_ptr<const CompilationDatabase::Arguments> get_arguments(const char* filename)
+	{
+		if (use_compilation_database) {
+			std::shared_ptr<const CompilationDatabase::Arguments> args =
+			    compilation_database.find(filename);
+			if (args) {
+				return args;
 			}
 		}
-		return tu;
+		return commandline_args;
 	}
 
-	void clear_translation_unit_cache()
+	static CXTranslationUnit parse_translation_unit(CXIndex index, const char* filename,
+	                                                const std::vector<std::string>& args,
+	                                                CXUnsavedFile unsaved)
 	{
-		std::map<std::string, CXTranslationUnit>::iterator it = tu_cache.begin();
-		while (it != tu_cache.end()) {
-			if (it->second) {
-				clang_disposeTranslationUnit(it->second);
+		std::unique_ptr<const char*[]> argv(new const char*[args.size()]);
+		for (size_t i = 0; i < args.size(); i++) {
+			argv[i] = args[i].c_str();
+		}
+		return clang_parseTranslationUnit(index, filename, argv.get(), args.size(), &unsaved, 1,
+		                                  clang_defaultEditingTranslationUnitOptions());
+	}
+
+	static bool has_fatal_error(CXTranslationUnit tu)
+	{
+		bool fatal = false;
+		for (unsigned i = 0; i < clang_getNumDiagnostics(tu); i++) {
+			CXDiagnostic diag = clang_getDiagnostic(tu, i);
+			if (clang_getDiagnosticSeverity(diag) == CXDiagnostic_Fatal) {
+				fatal = true;
 			}
-			++it;
+			clang_disposeDiagnostic(diag);
+		}
+		return fatal;
+	}
+
+	/// call with cache_mutex
+	void set_memory_usage(TranslationUnitEntry* entry, size_t usage)
+	{
+		tu_cache_memory -= entry->memory_usage;
+		entry->memory_usage = usage;
+		tu_cache_memory += entry->memory_usage;
+	}
+
+	/**
+	    call with cache_mutex, and with the lock of @a working if given. the unit is disposed
+	    now unless a thread works in it, results which still refer to the entry don't pin it.
+	 */
+	void remove_translation_unit(const std::string& filename,
+	                             TranslationUnitEntry* working = NULL)
+	{
+		std::map<std::string, TranslationUnitEntryPtr>::iterator it = tu_cache.find(filename);
+		if (it == tu_cache.end()) {
+			return;
+		}
+		TranslationUnitEntryPtr entry = it->second;
+		tu_cache_memory -= entry->memory_usage;
+		tu_lru.erase(entry->lru_pos);
+		tu_cache.erase(it);
+		// a thread which works in it disposes it with its last reference
+		if (entry.get() != working && entry->mutex.try_lock()) {
+			entry->dispose_unit();
+			entry->mutex.unlock();
+		}
+	}
+
+	/// evict least recently used units until the cache fits in the budget. the most recently
+	/// used one and units in use are kept. call with cache_mutex, and with the lock of
+	/// @a working if given.
+	void enforce_memory_limit(TranslationUnitEntry* working = NULL)
+	{
+		if (tu_cache_memory_limit == 0) {
+			return;
+		}
+		std::vector<std::string> victims;
+		size_t memory = tu_cache_memory;
+		for (std::list<std::string>::reverse_iterator it = tu_lru.rbegin();
+		     memory > tu_cache_memory_limit && std::next(it) != tu_lru.rend(); ++it) {
+			const TranslationUnitEntryPtr& entry = tu_cache[*it];
+			if (entry.get() == working || !entry->mutex.try_lock()) {
+				continue;  // a thread works in it
+			}
+			entry->mutex.unlock();
+			memory -= entry->memory_usage;
+			victims.push_back(*it);
+		}
+		for (size_t i = 0; i < victims.size(); i++) {
+			size_t freed = tu_cache[victims[i]]->memory_usage;
+			remove_translation_unit(victims[i], working);
+			std::cout << "evicted " << victims[i] << " from translation unit cache ("
+			          << freed / (1024 * 1024) << " MB freed, "
+			          << tu_cache_memory / (1024 * 1024) << " MB in use)" << std::endl;
+		}
+	}
+
+	/**
+	    reparse the translation unit if the buffer has changed since the last (re)parse.
+	    it keeps the precompiled preamble up to date. return false if the tu was discarded.
+	 */
+	bool update_translation_unit(const char* filename, TranslationUnitEntry* entry,
+	                             const CXUnsavedFile& unsaved)
+	{
+		if (!patch_content(entry, unsaved)) {
+			return true;
+		}
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		CXUnsavedFile patched = get_unsaved(entry, filename);
+		int err = clang_reparseTranslationUnit(entry->tu, 1, &patched,
+		                                       clang_defaultReparseOptions(entry->tu));
+		if (err != 0) {
+			// libclang requires disposing a translation unit which failed to reparse
+			std::cerr << "an unexpected error @ clang_reparseTranslationUnit" << std::endl;
+			clang_disposeTranslationUnit(entry->tu);
+			entry->tu = NULL;
+			return false;
+		}
+		std::cout << "reparsed " << filename << " in " << elapsed_msec(start) << " ms"
+		          << std::endl;
+		return true;
+	}
+
+	void clear_translation_unit_cache()
+	{
+		std::lock_guard<std::mutex> lock(cache_mutex);
+		// nothing runs while options change, so every unit goes now
+		while (!tu_lru.empty()) {
+			remove_translation_unit(tu_lru.front());
 		}
-		tu_cache.clear();
 	}
 
 	void set_option(std::vector<std::string>& options)
 	{
-		commandline_args.clear();
+		commandline_args.reset(new CompilationDatabase::Arguments());
+		commandline_args->args = options;
+		commandline_args->hash = hash_bytes("", 0);
 		for (size_t i = 0; i < options.size(); i++) {
-			commandline_args.push_back(options[i]);
+			commandline_args->hash = hash_bytes(options[i].c_str(), options[i].length() + 1,
+			                                    commandline_args->hash);
 		}
+		last_details.reset();
 		create_index();
 	}
 
-	void complete(CodeCompletionResults& result, const char* filename, const char* content,
-	              int line, int col, int flag)
+	void set_settings(const CodeCompletionSettings& settings)
+	{
+		tu_cache_memory_limit = settings.tu_cache_memory_limit;
+		preamble_cache.set_directory(settings.preamble_cache_dir);
+		preamble_cache.set_size_limit(settings.preamble_cache_size_limit);
+		use_compilation_database = settings.use_compilation_database;
+		max_results = settings.max_results;
+		fuzzy_filter = settings.fuzzy_filter;
+		last_details.reset();
+		std::lock_guard<std::mutex> lock(cache_mutex);
+		compilation_database.clear();  // pick up newly generated databases
+		enforce_memory_limit();
+	}
+
+	/**
+	    return an up-to-date translation unit for the buffer, locked by @a entry_lock.
+	    other files can be parsed meanwhile. @a unsaved is left pointing to the content of
+	    the entry, which the unit must be given.
+	 */
+	TranslationUnitEntryPtr get_updated_translation_unit(const char* filename,
+	                                                     CXUnsavedFile& unsaved,
+	                                                     std::unique_lock<std::mutex>& entry_lock)
 	{
-		if (index == NULL) {
+		std::shared_ptr<const CompilationDatabase::Arguments> arguments;
+		TranslationUnitEntryPtr entry;
+		{
+			std::lock_guard<std::mutex> lock(cache_mutex);
+			arguments = get_arguments(filename);
+			entry = find_entry(filename);
+		}
+
+		entry_lock = std::unique_lock<std::mutex>(entry->mutex);
+		entry->dispose_garbage();
+		if (entry->tu && entry->args_hash != arguments->hash) {
+			std::cout << "compiler arguments of " << filename << " changed" << std::endl;
+			clang_disposeTranslationUnit(entry->tu);
+			entry->tu = NULL;
+		}
+		if (entry->tu && entry->preamble_length != 0 && !has_same_preamble(entry.get(), unsaved)) {
+			// its precompiled header has the old preamble
+			std::cout << "preamble of " << filename << " changed" << std::endl;
+			clang_disposeTranslationUnit(entry->tu);
+			entry->tu = NULL;
+		}
+		if (entry->tu) {
+			update_translation_unit(filename, entry.get(), unsaved);
+		}
+		if (!entry->tu) {  // new, or retry with a fresh parse
+			parse_entry(filename, entry.get(), *arguments, unsaved);
+		}
+		unsaved = get_unsaved(entry.get(), filename);
+		size_t usage = entry->tu ? get_memory_usage(entry->tu) + entry->content.capacity() : 0;
+
+		std::lock_guard<std::mutex> lock(cache_mutex);
+		std::map<std::string, TranslationUnitEntryPtr>::iterator it = tu_cache.find(filename);
+		// released or evicted meanwhile: serve this request, the unit goes with the last user
+		bool cached = it != tu_cache.end() && it->second == entry;
+		if (!entry->tu) {
+			std::cerr << "an unexpected error @ clang_parseTranslationUnit" << std::endl;
+			if (cached) {
+				remove_translation_unit(filename, entry.get());
+			}
+			entry_lock.unlock();
+			return nullptr;
+		}
+		if (cached) {
+			set_memory_usage(entry.get(), usage);
+			enforce_memory_limit(entry.get());
+		}
+		return entry;
+	}
+
+	void prepare(const char* filename, const DocumentSnapshot& content)
+	{
+		if (!index) {
+			return;
+		}
+		CXUnsavedFile f[1];
+		f[0].Filename = filename;
+		f[0].Contents = content.data();
+		f[0].Length = content.length();
+		std::unique_lock<std::mutex> entry_lock;
+		get_updated_translation_unit(filename, f[0], entry_lock);
+	}
+
+	/// a unit in use is disposed once the request working in it ends
+	void release(const char* filename)
+	{
+		std::lock_guard<std::mutex> lock(cache_mutex);
+		if (tu_cache.count(filename)) {
+			remove_translation_unit(filename);
+			std::cout << "released " << filename << " from translation unit cache ("
+			          << tu_cache_memory / (1024 * 1024) << " MB in use)" << std::endl;
+		}
+	}
+
+	void complete(CodeCompletionResults& result, const char* filename,
+	              const DocumentSnapshot& content, int line, int col, const char* prefix,
+	              int flag)
+	{
+		if (!index) {
 			return;
 		}
 		result.clear();
 
-		CXTranslationUnit tu = get_translation_unit(filename, content);
-		if (!tu) {
-			std::cerr << "an unexpected error @ clang_parseTranslationUnit" << std::endl;
+		if ((flag & COMPLETE_FLAG_REFINE) && last_details && last_filename == filename &&
+		    last_line == line && last_col == col) {
+			// clang would answer the same, only the filter differs
+			select_results(result, last_details, prefix);
 			return;
 		}
+		last_details.reset();
+
 		CXUnsavedFile f[1];
 		f[0].Filename = filename;
-		f[0].Contents = content;
-		f[0].Length = strlen(content);
+		f[0].Contents = content.data();
+		f[0].Length = content.length();
 
+		std::unique_lock<std::mutex> entry_lock;
+		TranslationUnitEntryPtr entry = get_updated_translation_unit(filename, f[0], entry_lock);
+		if (!entry) {
+			return;
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 		unsigned comp_flag = clang_defaultCodeCompleteOptions();
 		CXCodeCompleteResults* results =
-		    clang_codeCompleteAt(tu, filename, line, col, f, 1, comp_flag);
+		    clang_codeCompleteAt(entry->tu, filename, line, col, f, 1, comp_flag);
 
 		if (!results) {
 			std::cerr << "an unexpected error @ clang_codeCompleteAt" << std::endl;
 			return;
 		}
+		std::cout << "completed " << filename << " in " << elapsed_msec(start) << " ms"
+		          << std::endl;
 
 		if (results->NumResults == 0) {
 			std::cerr << "no code completion!!!" << std::endl;
+			clang_disposeCodeCompleteResults(results);
 			return;
-		} else {
-			result.reserve(results->NumResults);
-			clang_sortCodeCompletionResults(results->Results, results->NumResults);
-			for (int i = 0; i < results->NumResults; i++) {
-				geanycc::CompleteResultType type = getCursorType(results->Results[i]);
-
-				if (type != COMPLETE_RESULT_NONE) {
-					result.push_back(CompleteResultRow());
-					CompleteResultRow& pr = result[result.size() - 1];
-					pr.type = type;
-					CompletionStringParser().parse(&pr, results->Results[i]);
+		}
+		entry_lock.unlock();  // reading the results does not touch the unit
+
+		clang_sortCodeCompletionResults(results->Results, results->NumResults);
+		last_details.reset(new ClangCompletionDetails(results, entry));
+		last_filename = filename;
+		last_line = line;
+		last_col = col;
+		select_results(result, last_details, prefix);
+	}
+
+	/**
+	    fill @a result with the candidates whose typed text starts with @a prefix, or contains
+	    it as a fuzzy subsequence. if there are more than max_results, only those which match
+	    best and clang ranks best are kept, still in alphabetical order.
+	*/
+	void select_results(CodeCompletionResults& result,
+	                    const std::shared_ptr<ClangCompletionDetails>& details,
+	                    const char* prefix)
+	{
+		const CXCodeCompleteResults* results = details->get();
+		size_t prefix_length = strlen(prefix);
+		CompletionStringParser parser;
+		candidates.clear();
+		for (unsigned i = 0; i < results->NumResults; i++) {
+			if (getCursorType(results->Results[i]) == COMPLETE_RESULT_NONE) {
+				continue;
+			}
+			Candidate candidate = {0, 0, i};
+			if (prefix_length != 0) {
+				parser.parse_typed_text(results->Results[i]);
+				if (fuzzy_filter) {
+					if (!fuzzy_match(prefix, prefix_length, parser.typed_text.c_str(),
+					                 parser.typed_text.length(), candidate.score)) {
+						continue;
+					}
+				} else if (parser.typed_text.compare(0, prefix_length, prefix) != 0) {
+					continue;
 				}
 			}
+			candidate.priority =
+			    clang_getCompletionPriority(results->Results[i].CompletionString);
+			candidates.push_back(candidate);
+		}
+		size_t total = candidates.size();
+		if (max_results != 0 && candidates.size() > max_results) {
+			std::nth_element(candidates.begin(), candidates.begin() + max_results,
+			                 candidates.end());
+			candidates.resize(max_results);
+			std::sort(candidates.begin(), candidates.end(),
+			          [](const Candidate& a, const Candidate& b) { return a.index < b.index; });
 		}
 
-		clang_disposeCodeCompleteResults(results);
+		// rows get their signatures from the details when they are displayed
+		result.set_details(details);
+		result.set_prefix(prefix);
+		result.set_total(total);
+		result.reserve(candidates.size(), candidates.size() * 16);
+		for (size_t i = 0; i < candidates.size(); i++) {
+			const CXCompletionResult& candidate = results->Results[candidates[i].index];
+			parser.parse_typed_text(candidate);
+			parser.store(result, getCursorType(candidate), candidates[i].index);
+		}
+		if (result.size() < total) {
+			std::cout << "kept " << result.size() << " of " << total << " results" << std::endl;
+		}
 	}
 
    private:
@@ -380,12 +984,25 @@ void CppCodeCompletion::set_option(std::vector<std::string>& options)
 	pimpl->set_option(options);
 }
 
+void CppCodeCompletion::set_settings(const CodeCompletionSettings& settings)
+{
+	pimpl->set_settings(settings);
+}
+
 void CppCodeCompletion::complete(CodeCompletionResults& result, const char* filename,
-                                 const char* content, int line, int col, int flag)
+                                 const DocumentSnapshot& content, int line, int col,
+                                 const char* prefix, int flag)
+{
+	pimpl->complete(result, filename, content, line, col, prefix, flag);
+}
+
+void CppCodeCompletion::prepare(const char* filename, const DocumentSnapshot& content)
 {
-	pimpl->complete(result, filename, content, line, col, flag);
+	pimpl->prepare(filename, content);
 }
 
+void CppCodeCompletion::release(const char* filename) { pimpl->release(filename); }
+
 // misc ////////////////////////////////////////////////////////////////////////
 struct CompletionStringParserDebugPrinter
 {
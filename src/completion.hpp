@@ -33,8 +33,12 @@ class CppCodeCompletion : public CodeCompletionBase
 	CppCodeCompletion();
 	~CppCodeCompletion();
 	void set_option(std::vector<std::string>& options);
-	void complete(CodeCompletionResults& result, const char* filename, const char* content,
-	              int line, int col, int flag = 0);
+	void set_settings(const CodeCompletionSettings& settings);
+	void complete(CodeCompletionResults& result, const char* filename,
+	              const DocumentSnapshot& content, int line, int col, const char* prefix,
+	              int flag = 0);
+	void prepare(const char* filename, const DocumentSnapshot& content);
+	void release(const char* filename);
 
    private:
 	CppCodeCompletion(const CppCodeCompletion&);
@@ -26,13 +26,17 @@
 #include "completion.hpp"
 
 #include <SciLexer.h>
+#include <dlfcn.h>
 
 namespace geanycc
 {
 
+static const char* HELPER_NAME = "geanyclangcomplete-helper";
+static const char* DAEMON_SOCKET_NAME = "geany-clang-complete.sock";
+
 CppCompletionFramework::CppCompletionFramework()
 {
-	completion = new CodeCompletionAsyncWrapper(new CppCodeCompletion());
+	set_engine(new CppCodeCompletion());
 }
 CppCompletionFramework::~CppCompletionFramework()
 {
@@ -42,6 +46,47 @@ CppCompletionFramework::~CppCompletionFramework()
 	}
 }
 
+/// the helper is installed beside the plugin
+static std::string get_helper_path()
+{
+	Dl_info info;
+	if (dladdr((void*)&get_helper_path, &info) == 0 || !info.dli_fname) {
+		return HELPER_NAME;
+	}
+	gchar* dir = g_path_get_dirname(info.dli_fname);
+	gchar* path = g_build_filename(dir, HELPER_NAME, NULL);
+	std::string ret(path);
+	g_free(path);
+	g_free(dir);
+	return ret;
+}
+
+/// the shared daemon listens in the runtime directory of the user
+static std::string get_daemon_socket_path()
+{
+	gchar* path = g_build_filename(g_get_user_runtime_dir(), DAEMON_SOCKET_NAME, NULL);
+	std::string ret(path);
+	g_free(path);
+	return ret;
+}
+
+void CppCompletionFramework::use_helper_process(bool use, bool shared)
+{
+	shared = use && shared;
+	if (use == in_helper_process && shared == helper_shared) {
+		return;
+	}
+	in_helper_process = use;
+	helper_shared = shared;
+	if (shared) {
+		set_engine(new RemoteCodeCompletion(get_helper_path(), get_daemon_socket_path()));
+	} else if (use) {
+		set_engine(new RemoteCodeCompletion(get_helper_path()));
+	} else {
+		set_engine(new CppCodeCompletion());
+	}
+}
+
 bool CppCompletionFramework::check_filetype(GeanyFiletype* ft) const
 {
 	if (ft == NULL) {
@@ -50,6 +95,19 @@ bool CppCompletionFramework::check_filetype(GeanyFiletype* ft) const
 	return (ft->id == GEANY_FILETYPES_C || ft->id == GEANY_FILETYPES_CPP);
 }
 
+static bool is_comment_or_string(int style_id)
+{
+	switch (style_id) {
+		case SCE_C_COMMENTLINE:
+		case SCE_C_COMMENT:
+		case SCE_C_COMMENTLINEDOC:
+		case SCE_C_COMMENTDOC:
+		case SCE_C_STRINGEOL:
+			return true;
+	}
+	return false;
+}
+
 bool CppCompletionFramework::check_trigger_char(GeanyEditor* editor)
 {
 	int pos = sci_get_current_position(editor->sci);
@@ -60,14 +118,8 @@ bool CppCompletionFramework::check_trigger_char(GeanyEditor* editor)
 	char c1 = sci_get_char_at(editor->sci, pos - 1);
 	ClangCompletePluginPref* pref = ClangCompletePluginPref::instance();
 
-	int style_id = sci_get_style_at(editor->sci, pos);
-	switch (style_id) {
-		case SCE_C_COMMENTLINE:
-		case SCE_C_COMMENT:
-		case SCE_C_COMMENTLINEDOC:
-		case SCE_C_COMMENTDOC:
-		case SCE_C_STRINGEOL:
-			return false;
+	if (is_comment_or_string(sci_get_style_at(editor->sci, pos))) {
+		return false;
 	}
 
 	if (pref->start_completion_with_scope_res) {
@@ -99,4 +151,17 @@ bool CppCompletionFramework::check_trigger_char(GeanyEditor* editor)
 	return false;
 }
 
+bool CppCompletionFramework::check_identifier_trigger(GeanyEditor* editor)
+{
+	int pos = sci_get_current_position(editor->sci);
+	if (pos < 1) {
+		return false;
+	}
+	// the style of the typed character, the one at pos may not be lexed yet
+	int style_id = sci_get_style_at(editor->sci, pos - 1);
+	return !is_comment_or_string(style_id) && style_id != SCE_C_STRING &&
+	       style_id != SCE_C_CHARACTER && style_id != SCE_C_NUMBER &&
+	       style_id != SCE_C_PREPROCESSOR;
+}
+
 } // namespace geanycc
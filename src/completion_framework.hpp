@@ -42,12 +42,26 @@ public:
 	    return true if typed . -> :: except for comments and strings, otherwise false.
 	 */
 	bool check_trigger_char(GeanyEditor* editor);
+	/**
+	    return true if an identifier typed here may start completion, otherwise false.
+	 */
+	bool check_identifier_trigger(GeanyEditor* editor);
 
 	GtkWidget* create_config_widget(GtkDialog* dialog);
 
 	void load_preferences();
 	void updated_preferences();
 	void save_preferences();
+
+private:
+	/**
+	    run clang in the helper process or in this one. a @a shared helper serves every Geany
+	    of this user.
+	*/
+	void use_helper_process(bool use, bool shared);
+
+	bool in_helper_process = false;
+	bool helper_shared = false;
 };
 
 }
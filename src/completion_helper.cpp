@@ -0,0 +1,120 @@
+/*
+ * completion_helper.cpp - a Geany plugin to provide code completion using clang
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+// the process which runs clang for the plugin, see geanycc::RemoteCodeCompletion.
+// requests come on the standard input, or with --daemon <socket> from every Geany which
+// connects to the socket.
+
+#include "completion.hpp"
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// the daemon log starts over at the next start past this size
+static const off_t LOG_SIZE_LIMIT = 1024 * 1024;
+
+/// close every descriptor but the standard ones
+static void close_inherited_fds()
+{
+	std::vector<int> fds;
+	DIR* dir = opendir("/proc/self/fd");
+	if (dir) {
+		while (struct dirent* entry = readdir(dir)) {
+			int fd = atoi(entry->d_name);
+			if (fd > STDERR_FILENO && fd != dirfd(dir)) {
+				fds.push_back(fd);
+			}
+		}
+		closedir(dir);
+	} else {
+		for (int fd = STDERR_FILENO + 1; fd < 1024; fd++) {
+			fds.push_back(fd);
+		}
+	}
+	for (size_t i = 0; i < fds.size(); i++) {
+		close(fds[i]);
+	}
+}
+
+/**
+    detach from the editor which started this: the parent returns to the editor which waits
+    for it, the child outlives the editor. it keeps nothing the editor opened, its output
+    goes to @a log_path.
+*/
+static void daemonize(const std::string& log_path)
+{
+	pid_t pid = fork();
+	if (pid != 0) {
+		_exit(pid < 0 ? 1 : 0);
+	}
+	setsid();
+	if (chdir("/") != 0) {
+		std::cerr << "cannot change to /" << std::endl;
+	}
+	signal(SIGPIPE, SIG_IGN);  // a client may hang up while it is answered
+
+	int null_fd = open("/dev/null", O_RDONLY);
+	// appended, a daemon which finds another one running leaves its log alone unless it
+	// has grown too big
+	int log_fd = open(log_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0600);
+	struct stat st;
+	if (log_fd >= 0 && fstat(log_fd, &st) == 0 && st.st_size > LOG_SIZE_LIMIT &&
+	    ftruncate(log_fd, 0) != 0) {
+		std::cerr << "cannot truncate " << log_path << std::endl;
+	}
+	if (log_fd < 0) {
+		log_fd = open("/dev/null", O_WRONLY);
+	}
+	if (null_fd >= 0) {
+		dup2(null_fd, STDIN_FILENO);
+	}
+	if (log_fd >= 0) {
+		dup2(log_fd, STDOUT_FILENO);
+		dup2(log_fd, STDERR_FILENO);
+	}
+	close_inherited_fds();
+}
+
+static geanycc::CodeCompletionBase* create_engine() { return new geanycc::CppCodeCompletion(); }
+
+int main(int argc, char** argv)
+{
+	if (argc == 3 && strcmp(argv[1], "--daemon") == 0 && argv[2][0] == '/') {
+		daemonize(std::string(argv[2]) + ".log");
+		geanycc::serve_shared_completion(create_engine, argv[2]);
+	} else if (argc == 1) {
+		geanycc::serve_completion(create_engine, STDIN_FILENO);
+	} else {
+		std::cerr << "usage: " << argv[0] << " [--daemon <absolute socket path>]" << std::endl;
+		return 2;
+	}
+	// no editor uses it, threads still winding down need not be waited for
+	_exit(0);
+}
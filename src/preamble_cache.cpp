@@ -0,0 +1,347 @@
+/*
+ * preamble_cache.cpp - a Geany plugin to provide code completion using clang
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include "preamble_cache.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <memory>
+#include <cstdio>
+#include <cstring>
+#include <cctype>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+
+using namespace geanycc;
+
+namespace
+{
+/**
+    length of the leading part of content which consists only of blank lines, comments and
+    preprocessor directives, cut at the last line where no conditional directive is open.
+    return 0 if that part includes no header.
+ */
+size_t find_preamble_length(const char* content, size_t length)
+{
+	size_t preamble_length = 0;
+	bool include_found = false;
+	bool include_in_preamble = false;
+	bool in_comment = false;
+	int depth = 0;
+
+	size_t pos = 0;
+	while (pos < length) {
+		size_t eol = pos;
+		while (eol < length && content[eol] != '\n') {
+			eol++;
+		}
+		const char* p = content + pos;
+		const char* end = content + eol;
+		while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+			p++;
+		}
+
+		if (in_comment) {
+			const char* close = std::search(p, end, "*/", "*/" + 2);
+			if (close != end) {
+				in_comment = false;
+			}
+		} else if (p == end || (end - p >= 2 && p[0] == '/' && p[1] == '/')) {
+			// blank line or line comment
+		} else if (end - p >= 2 && p[0] == '/' && p[1] == '*') {
+			const char* close = std::search(p + 2, end, "*/", "*/" + 2);
+			in_comment = (close == end);
+		} else if (*p == '#') {
+			p++;
+			while (p < end && (*p == ' ' || *p == '\t')) {
+				p++;
+			}
+			std::string directive;
+			while (p < end && isalpha((unsigned char)*p)) {
+				directive += *p++;
+			}
+			if (directive == "if" || directive == "ifdef" || directive == "ifndef") {
+				depth++;
+			} else if (directive == "endif") {
+				depth--;
+			} else if (directive == "include") {
+				include_found = true;
+			}
+			// continued lines belong to this directive
+			while (eol < length && eol > pos && content[eol - 1] == '\\') {
+				eol++;
+				while (eol < length && content[eol] != '\n') {
+					eol++;
+				}
+			}
+		} else {
+			break;  // first line of code
+		}
+
+		pos = (eol < length) ? eol + 1 : eol;
+		if (depth == 0 && !in_comment) {
+			preamble_length = pos;
+			include_in_preamble = include_found;
+		}
+	}
+	return include_in_preamble ? preamble_length : 0;
+}
+
+bool ends_with(const std::string& str, const char* suffix)
+{
+	size_t len = strlen(suffix);
+	return str.length() >= len && str.compare(str.length() - len, len, suffix) == 0;
+}
+
+size_t hash_header_times(const std::vector<std::string>& headers, bool* all_found)
+{
+	size_t h = hash_bytes("", 0);
+	*all_found = true;
+	for (size_t i = 0; i < headers.size(); i++) {
+		struct stat st;
+		if (stat(headers[i].c_str(), &st) != 0) {
+			*all_found = false;
+			return 0;
+		}
+		long long stamp[2] = {(long long)st.st_mtime, (long long)st.st_size};
+		h = hash_bytes(headers[i].c_str(), headers[i].length(), h);
+		h = hash_bytes((const char*)stamp, sizeof(stamp), h);
+	}
+	return h;
+}
+
+/// other processes may read the cache meanwhile, so they see the old file or the whole new one
+bool write_file(const std::string& path, const std::string& data)
+{
+	std::string temp_path = path + ".XXXXXX";
+	int fd = mkstemp(&temp_path[0]);
+	if (fd < 0) {
+		return false;
+	}
+	bool written = write(fd, data.data(), data.length()) == (ssize_t)data.length();
+	written = (close(fd) == 0) && written;
+	if (!written || rename(temp_path.c_str(), path.c_str()) != 0) {
+		remove(temp_path.c_str());
+		return false;
+	}
+	return true;
+}
+
+void remove_entry_files(const std::string& key_path)
+{
+	const char* suffixes[] = {".pch", ".deps", ".h", ".hpp"};
+	for (size_t i = 0; i < sizeof(suffixes) / sizeof(suffixes[0]); i++) {
+		remove((key_path + suffixes[i]).c_str());
+	}
+}
+
+struct InclusionCollector
+{
+	std::string preamble_header;
+	std::vector<std::string> headers;
+
+	static void visit(CXFile included_file, CXSourceLocation* inclusion_stack,
+	                  unsigned include_len, CXClientData client_data)
+	{
+		InclusionCollector* self = static_cast<InclusionCollector*>(client_data);
+		CXString name = clang_getFileName(included_file);
+		const char* cstr = clang_getCString(name);
+		if (cstr && self->preamble_header != cstr) {
+			self->headers.push_back(cstr);
+		}
+		clang_disposeString(name);
+	}
+};
+}  // namespace
+
+std::string PreambleCache::get(CXIndex index, const char* filename,
+                               const std::vector<std::string>& args, const char* content,
+                               size_t length, size_t& preamble_length)
+{
+	preamble_length = 0;
+	if (!is_enabled()) {
+		return "";
+	}
+	preamble_length = find_preamble_length(content, length);
+	if (preamble_length == 0) {
+		return "";
+	}
+	std::string preamble(content, preamble_length);
+	size_t preamble_hash = hash_bytes(preamble.c_str(), preamble.length());
+
+	size_t key = hash_bytes(filename, strlen(filename) + 1);
+	for (size_t i = 0; i < args.size(); i++) {
+		key = hash_bytes(args[i].c_str(), args[i].length() + 1, key);
+	}
+	char key_str[32];
+	snprintf(key_str, sizeof(key_str), "%016llx", (unsigned long long)key);
+	std::string key_path = directory + "/" + key_str;
+	std::string pch_path = key_path + ".pch";
+
+	// validate the stored entry
+	std::ifstream deps((key_path + ".deps").c_str());
+	if (deps) {
+		size_t stored_preamble_hash = 0, stored_times_hash = 0;
+		deps >> std::hex >> stored_preamble_hash >> stored_times_hash;
+		deps.ignore(1);
+		std::vector<std::string> headers;
+		std::string header;
+		while (std::getline(deps, header)) {
+			headers.push_back(header);
+		}
+		bool all_found = false;
+		if (deps.eof() && stored_preamble_hash == preamble_hash &&
+		    hash_header_times(headers, &all_found) == stored_times_hash && all_found) {
+			struct stat st;
+			if (stat(pch_path.c_str(), &st) == 0) {
+				utime(pch_path.c_str(), NULL);  // mark as recently used
+				return pch_path;
+			}
+		}
+		std::cout << "preamble cache of " << filename << " is out of date" << std::endl;
+	}
+	remove_entry_files(key_path);
+	return build(index, key_path, filename, args, preamble, preamble_hash);
+}
+
+void PreambleCache::invalidate(const std::string& pch_path)
+{
+	if (ends_with(pch_path, ".pch")) {
+		remove_entry_files(pch_path.substr(0, pch_path.length() - 4));
+	}
+}
+
+std::string PreambleCache::build(CXIndex index, const std::string& key_path, const char* filename,
+                                 const std::vector<std::string>& args, const std::string& preamble,
+                                 size_t preamble_hash)
+{
+	bool is_c = ends_with(filename, ".c");
+	std::string header_path = key_path + (is_c ? ".h" : ".hpp");
+	std::string pch_path = key_path + ".pch";
+	if (!write_file(header_path, preamble + "\n")) {
+		std::cerr << "failed to write " << header_path << std::endl;
+		return "";
+	}
+
+	// "quoted" includes must still be looked up beside the source file
+	std::string source_dir(filename);
+	size_t slash = source_dir.rfind('/');
+	source_dir = (slash == std::string::npos) ? "." : source_dir.substr(0, slash);
+
+	std::vector<const char*> argv;
+	argv.push_back("-iquote");
+	argv.push_back(source_dir.c_str());
+	for (size_t i = 0; i < args.size(); i++) {
+		argv.push_back(args[i].c_str());
+	}
+	argv.push_back("-x");
+	argv.push_back(is_c ? "c-header" : "c++-header");
+	CXTranslationUnit tu = clang_parseTranslationUnit(
+	    index, header_path.c_str(), argv.data(), argv.size(), NULL, 0,
+	    CXTranslationUnit_Incomplete | CXTranslationUnit_ForSerialization);
+	if (!tu) {
+		remove_entry_files(key_path);
+		return "";
+	}
+
+	// an erroneous preamble would only make things worse for the real parse
+	bool has_error = false;
+	for (unsigned i = 0; i < clang_getNumDiagnostics(tu); i++) {
+		CXDiagnostic diag = clang_getDiagnostic(tu, i);
+		if (clang_getDiagnosticSeverity(diag) >= CXDiagnostic_Error) {
+			has_error = true;
+		}
+		clang_disposeDiagnostic(diag);
+	}
+
+	InclusionCollector collector;
+	collector.preamble_header = header_path;
+	clang_getInclusions(tu, InclusionCollector::visit, &collector);
+
+	bool saved = !has_error && clang_saveTranslationUnit(tu, pch_path.c_str(),
+	                                                     clang_defaultSaveOptions(tu)) ==
+	                               CXSaveError_None;
+	clang_disposeTranslationUnit(tu);
+
+	bool all_found = false;
+	size_t times_hash = hash_header_times(collector.headers, &all_found);
+	if (!saved || !all_found) {
+		remove_entry_files(key_path);
+		return "";
+	}
+
+	std::ostringstream deps;
+	deps << std::hex << preamble_hash << "\n" << times_hash << "\n";
+	for (size_t i = 0; i < collector.headers.size(); i++) {
+		deps << collector.headers[i] << "\n";
+	}
+	if (!write_file(key_path + ".deps", deps.str())) {
+		remove_entry_files(key_path);
+		return "";
+	}
+	std::cout << "stored preamble of " << filename << " (" << collector.headers.size()
+	          << " headers)" << std::endl;
+	evict();
+	return pch_path;
+}
+
+/// remove least recently used entries until the cache fits in the limit
+void PreambleCache::evict()
+{
+	struct Entry
+	{
+		std::string key_path;
+		time_t used;
+		size_t size;
+		bool operator<(const Entry& other) const { return used < other.used; }
+	};
+	std::vector<Entry> entries;
+	size_t total = 0;
+
+	DIR* dir = opendir(directory.c_str());
+	if (!dir) {
+		return;
+	}
+	while (struct dirent* ent = readdir(dir)) {
+		std::string path = directory + "/" + ent->d_name;
+		struct stat st;
+		if (ends_with(path, ".pch") && stat(path.c_str(), &st) == 0) {
+			Entry entry = {path.substr(0, path.length() - 4), st.st_mtime, (size_t)st.st_size};
+			entries.push_back(entry);
+			total += entry.size;
+		}
+	}
+	closedir(dir);
+
+	std::sort(entries.begin(), entries.end());
+	// the newest entry is always kept
+	for (size_t i = 0; i + 1 < entries.size() && total > size_limit; i++) {
+		remove_entry_files(entries[i].key_path);
+		total -= entries[i].size;
+		std::cout << "evicted " << entries[i].key_path << " from preamble cache" << std::endl;
+	}
+}
@@ -0,0 +1,76 @@
+/*
+ * preamble_cache.hpp - a Geany plugin to provide code completion using clang
+ *
+ * Copyright (C) 2014-2015 Noto, Yuta <nonotetau(at)gmail(dot)com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <clang-c/Index.h>
+
+namespace geanycc
+{
+/// FNV-1a
+inline size_t hash_bytes(const char* data, size_t length, size_t h = 14695981039346656037ULL)
+{
+	for (size_t i = 0; i < length; i++) {
+		h ^= (unsigned char)data[i];
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+/**
+    keeps precompiled headers of source file preambles (the leading #include block) on disk,
+    so that the first parse after restarting Geany does not compile every header again.
+
+    an entry is keyed by the source path and compiler options, and is valid while
+    the preamble text and the modification times of all headers it includes are unchanged.
+*/
+class PreambleCache
+{
+   public:
+	void set_directory(const std::string& dir) { directory = dir; }
+	/// total bytes of precompiled headers to keep (0: disabled)
+	void set_size_limit(size_t bytes) { size_limit = bytes; }
+	bool is_enabled() const { return !directory.empty() && size_limit != 0; }
+
+	/**
+	    return a path to a precompiled header for the preamble of @a content,
+	    building it if there is no valid one. return an empty string if the file has no
+	    cacheable preamble or building fails. the first @a preamble_length bytes of
+	    @a content are in the header, the parse which includes it must not see them again.
+	*/
+	std::string get(CXIndex index, const char* filename, const std::vector<std::string>& args,
+	                const char* content, size_t length, size_t& preamble_length);
+
+	/// drop an entry which clang could not use
+	void invalidate(const std::string& pch_path);
+
+   private:
+	std::string directory;
+	size_t size_limit = 0;
+
+	std::string build(CXIndex index, const std::string& key_path, const char* filename,
+	                  const std::vector<std::string>& args, const std::string& preamble,
+	                  size_t preamble_hash);
+	void evict();
+};
+}
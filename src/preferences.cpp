@@ -39,8 +39,18 @@ static struct PrefWidget
     GtkWidget* start_with_dot;
     GtkWidget* start_with_arrow;
     GtkWidget* start_with_scope_res;
+    GtkWidget* auto_trigger_spinbtn;
+    GtkWidget* use_compilation_database;
     GtkWidget* row_text_max_spinbtn;
     GtkWidget* swin_height_max_spinbtn;
+    GtkWidget* max_suggestions_spinbtn;
+    GtkWidget* fuzzy_filter;
+    GtkWidget* deadline_spinbtn;
+    GtkWidget* tu_cache_memory_spinbtn;
+    GtkWidget* preamble_cache_size_spinbtn;
+    GtkWidget* run_in_helper_process;
+    GtkWidget* share_helper_process;
+    GtkWidget* stale_kill_spinbtn;
     GtkTextBuffer* options_text_buf;
     GtkEntryBuffer* command_buffer;
 
@@ -77,6 +87,10 @@ static void on_configure_response(GtkDialog* dialog, gint response, gpointer use
 	    gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(pref_widgets.start_with_arrow));
 	pref->start_completion_with_scope_res =
 	    gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(pref_widgets.start_with_scope_res));
+	pref->auto_trigger_chars =
+	    gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(pref_widgets.auto_trigger_spinbtn));
+	pref->use_compilation_database =
+	    gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(pref_widgets.use_compilation_database));
 
 	pref->row_text_max =
 	    gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(pref_widgets.row_text_max_spinbtn));
@@ -84,6 +98,29 @@ static void on_configure_response(GtkDialog* dialog, gint response, gpointer use
 	pref->suggestion_window_height_max =
 	    gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(pref_widgets.swin_height_max_spinbtn));
 
+	pref->max_suggestions =
+	    gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(pref_widgets.max_suggestions_spinbtn));
+
+	pref->fuzzy_filter =
+	    gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(pref_widgets.fuzzy_filter));
+
+	pref->completion_deadline_ms =
+	    gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(pref_widgets.deadline_spinbtn));
+
+	pref->tu_cache_memory_limit_mb =
+	    gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(pref_widgets.tu_cache_memory_spinbtn));
+
+	pref->preamble_cache_size_mb =
+	    gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(pref_widgets.preamble_cache_size_spinbtn));
+
+	pref->run_in_helper_process =
+	    gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(pref_widgets.run_in_helper_process));
+	pref->share_helper_process =
+	    gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(pref_widgets.share_helper_process));
+
+	pref->stale_kill_ms =
+	    gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(pref_widgets.stale_kill_spinbtn));
+
 	self->save_preferences();
 	self->updated_preferences();
     }
@@ -176,6 +213,14 @@ GtkWidget* geanycc::CppCompletionFramework::create_config_widget(GtkDialog* dial
     gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(pref_widgets.start_with_scope_res),
 				 pref->start_completion_with_scope_res);
 
+    pref_widgets.auto_trigger_spinbtn = GETOBJ("spin_autotrigger");
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(pref_widgets.auto_trigger_spinbtn),
+			      pref->auto_trigger_chars);
+
+    pref_widgets.use_compilation_database = GETOBJ("cbtn_compiledb");
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(pref_widgets.use_compilation_database),
+				 pref->use_compilation_database);
+
     // compiler options
     GtkWidget* options_text_view = GETOBJ("tv_compileopt");
     // load compiler options
@@ -204,6 +249,38 @@ GtkWidget* geanycc::CppCompletionFramework::create_config_widget(GtkDialog* dial
     gtk_spin_button_set_value(GTK_SPIN_BUTTON(pref_widgets.swin_height_max_spinbtn),
 			      pref->suggestion_window_height_max);
 
+    pref_widgets.max_suggestions_spinbtn = GETOBJ("spin_maxsuggest");
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(pref_widgets.max_suggestions_spinbtn),
+			      pref->max_suggestions);
+
+    pref_widgets.fuzzy_filter = GETOBJ("cbtn_fuzzy");
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(pref_widgets.fuzzy_filter),
+				 pref->fuzzy_filter);
+
+    pref_widgets.deadline_spinbtn = GETOBJ("spin_deadline");
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(pref_widgets.deadline_spinbtn),
+			      pref->completion_deadline_ms);
+
+    // ** translation unit cache **
+    pref_widgets.tu_cache_memory_spinbtn = GETOBJ("spin_tucachemem");
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(pref_widgets.tu_cache_memory_spinbtn),
+			      pref->tu_cache_memory_limit_mb);
+
+    pref_widgets.preamble_cache_size_spinbtn = GETOBJ("spin_preamblecache");
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(pref_widgets.preamble_cache_size_spinbtn),
+			      pref->preamble_cache_size_mb);
+
+    pref_widgets.stale_kill_spinbtn = GETOBJ("spin_stalekill");
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(pref_widgets.stale_kill_spinbtn),
+			      pref->stale_kill_ms);
+
+    pref_widgets.run_in_helper_process = GETOBJ("cbtn_helper");
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(pref_widgets.run_in_helper_process),
+				 pref->run_in_helper_process);
+    pref_widgets.share_helper_process = GETOBJ("cbtn_sharehelper");
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(pref_widgets.share_helper_process),
+				 pref->share_helper_process);
+
     g_signal_connect(dialog, "response", G_CALLBACK(on_configure_response), this);
     GtkWidget* vbox = GETOBJ("box_prefcpp");
     return vbox;
@@ -225,10 +302,41 @@ void geanycc::CppCompletionFramework::load_preferences()
 	    g_key_file_get_boolean(keyfile, group, "start_completion_with_arrow", NULL);
 	pref->start_completion_with_scope_res = g_key_file_get_boolean(
 	    keyfile, group, "start_completion_with_scope_resolution", NULL);
+	pref->auto_trigger_chars =
+	    g_key_file_has_key(keyfile, group, "auto_trigger_chars", NULL)
+		? g_key_file_get_integer(keyfile, group, "auto_trigger_chars", NULL)
+		: 0;
+	pref->use_compilation_database =
+	    g_key_file_get_boolean(keyfile, group, "use_compilation_database", NULL);
 	pref->row_text_max =
 	    g_key_file_get_integer(keyfile, group, "maximum_char_in_row", NULL);
 	pref->suggestion_window_height_max =
 	    g_key_file_get_integer(keyfile, group, "maximum_sug_window_height", NULL);
+	pref->max_suggestions =
+	    g_key_file_has_key(keyfile, group, "maximum_suggestions", NULL)
+		? g_key_file_get_integer(keyfile, group, "maximum_suggestions", NULL)
+		: 0;
+	pref->fuzzy_filter = g_key_file_get_boolean(keyfile, group, "fuzzy_filter", NULL);
+	pref->completion_deadline_ms =
+	    g_key_file_has_key(keyfile, group, "completion_deadline_ms", NULL)
+		? g_key_file_get_integer(keyfile, group, "completion_deadline_ms", NULL)
+		: 300;
+	pref->tu_cache_memory_limit_mb =
+	    g_key_file_has_key(keyfile, group, "tu_cache_memory_limit_mb", NULL)
+		? g_key_file_get_integer(keyfile, group, "tu_cache_memory_limit_mb", NULL)
+		: 2048;
+	pref->preamble_cache_size_mb =
+	    g_key_file_has_key(keyfile, group, "preamble_cache_size_mb", NULL)
+		? g_key_file_get_integer(keyfile, group, "preamble_cache_size_mb", NULL)
+		: 1024;
+	pref->run_in_helper_process =
+	    g_key_file_get_boolean(keyfile, group, "run_in_helper_process", NULL);
+	pref->share_helper_process =
+	    g_key_file_get_boolean(keyfile, group, "share_helper_process", NULL);
+	pref->stale_kill_ms =
+	    g_key_file_has_key(keyfile, group, "stale_kill_ms", NULL)
+		? g_key_file_get_integer(keyfile, group, "stale_kill_ms", NULL)
+		: 5000;
 	pref->compiler_options =
 	    geanycc::util::get_vector_from_keyfile_stringlist(
 		keyfile, group, "compiler_options", NULL);
@@ -239,8 +347,18 @@ void geanycc::CppCompletionFramework::load_preferences()
 	pref->start_completion_with_dot = true;
 	pref->start_completion_with_arrow = true;
 	pref->start_completion_with_scope_res = true;
+	pref->auto_trigger_chars = 0;
+	pref->use_compilation_database = false;
 	pref->row_text_max = 120;
 	pref->suggestion_window_height_max = 300;
+	pref->max_suggestions = 0;
+	pref->fuzzy_filter = false;
+	pref->completion_deadline_ms = 300;
+	pref->tu_cache_memory_limit_mb = 2048;
+	pref->preamble_cache_size_mb = 1024;
+	pref->run_in_helper_process = false;
+	pref->share_helper_process = false;
+	pref->stale_kill_ms = 5000;
     }
     g_key_file_free(keyfile);
 
@@ -259,9 +377,25 @@ void geanycc::CppCompletionFramework::save_preferences()
 			   pref->start_completion_with_arrow);
     g_key_file_set_boolean(keyfile, group, "start_completion_with_scope_resolution",
 			   pref->start_completion_with_scope_res);
+    g_key_file_set_integer(keyfile, group, "auto_trigger_chars", pref->auto_trigger_chars);
+    g_key_file_set_boolean(keyfile, group, "use_compilation_database",
+			   pref->use_compilation_database);
     g_key_file_set_integer(keyfile, group, "maximum_char_in_row", pref->row_text_max);
     g_key_file_set_integer(keyfile, group, "maximum_sug_window_height",
 			   pref->suggestion_window_height_max);
+    g_key_file_set_integer(keyfile, group, "maximum_suggestions", pref->max_suggestions);
+    g_key_file_set_boolean(keyfile, group, "fuzzy_filter", pref->fuzzy_filter);
+    g_key_file_set_integer(keyfile, group, "completion_deadline_ms",
+			   pref->completion_deadline_ms);
+    g_key_file_set_integer(keyfile, group, "tu_cache_memory_limit_mb",
+			   pref->tu_cache_memory_limit_mb);
+    g_key_file_set_integer(keyfile, group, "preamble_cache_size_mb",
+			   pref->preamble_cache_size_mb);
+    g_key_file_set_boolean(keyfile, group, "run_in_helper_process",
+			   pref->run_in_helper_process);
+    g_key_file_set_boolean(keyfile, group, "share_helper_process",
+			   pref->share_helper_process);
+    g_key_file_set_integer(keyfile, group, "stale_kill_ms", pref->stale_kill_ms);
     geanycc::util::set_keyfile_stringlist_by_vector(keyfile, group, "compiler_options",
 						    pref->compiler_options);
 
@@ -273,9 +407,28 @@ void geanycc::CppCompletionFramework::save_preferences()
 void geanycc::CppCompletionFramework::updated_preferences()
 {
     ClangCompletePluginPref* pref = ClangCompletePluginPref::instance();
+    this->use_helper_process(pref->run_in_helper_process, pref->share_helper_process);
     this->set_completion_option(pref->compiler_options);
+
+    geanycc::CodeCompletionSettings settings;
+    settings.tu_cache_memory_limit = (size_t)pref->tu_cache_memory_limit_mb * 1024 * 1024;
+    settings.use_compilation_database = pref->use_compilation_database;
+    settings.preamble_cache_size_limit = (size_t)pref->preamble_cache_size_mb * 1024 * 1024;
+    settings.max_results = pref->max_suggestions;
+    settings.fuzzy_filter = pref->fuzzy_filter;
+    settings.stale_kill_ms = pref->stale_kill_ms;
+    gchar* cache_dir =
+	g_build_filename(g_get_user_cache_dir(), "geany-clang-complete", "preamble", NULL);
+    if (g_mkdir_with_parents(cache_dir, 0700) == 0) {
+	settings.preamble_cache_dir = cache_dir;
+    }
+    g_free(cache_dir);
+    this->set_completion_settings(settings);
+    this->auto_trigger_chars = pref->auto_trigger_chars;
+    this->completion_deadline_ms = pref->completion_deadline_ms;
     if (this->suggestion_window) {
 	this->suggestion_window->set_max_char_in_row(pref->row_text_max);
 	this->suggestion_window->set_max_window_height(pref->suggestion_window_height_max);
+	this->suggestion_window->set_fuzzy_filter(pref->fuzzy_filter);
     }
 }
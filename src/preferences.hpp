@@ -27,11 +27,21 @@
 struct ClangCompletePluginPref
 {
 	std::vector<std::string> compiler_options;
+	bool use_compilation_database;
 	bool start_completion_with_dot;
 	bool start_completion_with_arrow;
 	bool start_completion_with_scope_res;
+	int auto_trigger_chars;  // 0: off
 	int row_text_max;
 	int suggestion_window_height_max;
+	int max_suggestions;
+	bool fuzzy_filter;
+	int completion_deadline_ms;  // 0: wait for clang
+	int tu_cache_memory_limit_mb;
+	int preamble_cache_size_mb;
+	bool run_in_helper_process;
+	bool share_helper_process;
+	int stale_kill_ms;  // 0: never
 
 	static ClangCompletePluginPref* instance()
 	{